@@ -241,6 +241,16 @@
 //#define PROBING_HEATERS_OFF       // Turn heaters off when probing
 //#define PROBING_FANS_OFF          // Turn fans off when probing
 
+// Shorten the time spent probing the bed.
+// The raise between points follows the bed deviation measured so far plus
+// PROBE_RAISE_MARGIN (never more than Z_PROBE_BETWEEN_HEIGHT), UBL walks the
+// mesh to the nearest unprobed point and G29 starts probing as soon as all
+// heaters are within PROBE_HEATING_WINDOW of their target.
+// Start script example: M140 S60, M104 S200, G28, G29, M190 S60, M109 S200
+//#define PROBE_SEQUENCE_OPTIMIZATION
+#define PROBE_RAISE_MARGIN    2 // (mm) Clearance added to the measured bed deviation
+#define PROBE_HEATING_WINDOW  5 // (°C) Start probing when the heaters are this close to the target
+
 // Add a bed leveling sub-menu for ABL or MBL.
 // Include a guided procedure if manual probing is enabled.
 //#define LCD_BED_LEVELING
@@ -457,12 +467,25 @@
 
 // When the nozzle is off the mesh, this value is used as the Z-Height correction value.
 //#define UBL_Z_RAISE_WHEN_OFF_MESH 2.5
+
+// Store the meshes as int16 microns from a best-fit plane with a validity
+// bitmap and a CRC, about half the size of the float mesh so more slots fit.
+//#define UBL_COMPACT_MESH
+// Extra mesh slots stored on the SD card (meshNN.dat), numbered after the EEPROM slots.
+// Requires UBL_COMPACT_MESH and SDSUPPORT. 0 to disable.
+#define UBL_MESH_SD_SLOTS 0
 /** END UNIFIED BED LEVELING **/
 
 /** START MESH BED LEVELING or AUTO BED LEVELING LINEAR or AUTO BED LEVELING BILINEAR or UNIFIED BED LEVELING **/
 // Set the number of grid points per dimension
 #define GRID_MAX_POINTS_X 3
 #define GRID_MAX_POINTS_Y 3
+
+// Send a leveled move to the planner as a single block when the mesh correction
+// along it stays within this distance (mm) of the line between its ends.
+// Otherwise the move is split at the mesh cell edges.
+// Only for MESH BED LEVELING and AUTO BED LEVELING BILINEAR, the planner does not level UBL moves.
+//#define MESH_SEGMENT_TOLERANCE 0.005
 /** END MESH BED LEVELING or AUTO BED LEVELING LINEAR or AUTO BED LEVELING BILINEAR or UNIFIED BED LEVELING **/
 
 /** START AUTO BED LEVELING LINEAR or AUTO BED LEVELING BILINEAR **/
@@ -483,6 +506,19 @@
 //#define ABL_BILINEAR_SUBDIVISION
 // Number of subdivisions between probe points
 #define BILINEAR_SUBDIVISIONS 3
+
+// Bicubic (Catmull-Rom) interpolation of the probed grid.
+// 16 coefficients per cell are computed when the mesh changes, giving a smooth
+// surface from a sparse grid without the RAM of the subdivided grid.
+// Moves are split every quarter of a cell to follow the curved surface.
+// RAM: (GRID_MAX_POINTS_X - 1) * (GRID_MAX_POINTS_Y - 1) * 64 bytes
+//#define ABL_BICUBIC_INTERPOLATION
+
+// Adaptive mesh: G29 U probes only the grid points under the print area plus a margin
+// and keeps the stored mesh for the other points.
+// The print area is set with G29 U L R F B or read from the header of the SD file (Cura ;MINX ;MINY ;MAXX ;MAXY).
+//#define ADAPTIVE_MESH_LEVELING
+#define ADAPTIVE_MESH_MARGIN 10   // (mm)
 /** END AUTO_BED_LEVELING_LINEAR or AUTO_BED_LEVELING_BILINEAR **/
 
 /** START AUTO_BED_LEVELING_3POINT or UNIFIED BED LEVELING **/
@@ -649,10 +685,15 @@
  * to compensate for any mechanical hysteresis your printer has.                         *
  * Set the parameters with M99 X<in mm> Y<in mm> Z<in mm>                                *
  *                                                                                       *
+ * The smoothing distance spreads the correction over that much motion on the axis       *
+ * after a reversal, instead of adding it all to the first block.                        *
+ * Set it with M99 I<X mm> J<Y mm> K<Z mm>                                               *
+ *                                                                                       *
  *****************************************************************************************/
 //#define HYSTERESIS_FEATURE
 
 // Define values for hysteresis distance and correction.
 #define HYSTERESIS_AXIS_MM    { 0, 0, 0 } // mm
 #define HYSTERESIS_CORRECTION 0.0         // 0.0 = no correction; 1.0 = full correction
+#define HYSTERESIS_SMOOTHING_MM { 0, 0, 0 } // mm, 0 = whole correction in one block
 /*****************************************************************************************/
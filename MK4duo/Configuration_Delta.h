@@ -80,6 +80,12 @@
 // Subsegment per line 10 - xxx
 #define DELTA_SEGMENTS_PER_LINE 20
 
+// Split moves by the curvature of the tower motion instead of by time, so the
+// straight tower moves stay within this distance (mm) of the Cartesian line.
+// Fewer lines are used near the center, more near the edges. The lines set by
+// DELTA_SEGMENTS_PER_SECOND and DELTA_SEGMENTS_PER_LINE (M666 L) stay the upper limit.
+//#define KINEMATIC_SEGMENT_DEVIATION 0.025
+
 // NOTE: All following values for DELTA_* MUST be floating point,
 // so always have a decimal point in them.
 //
@@ -314,6 +320,16 @@
 //#define PROBING_HEATERS_OFF       // Turn heaters off when probing
 //#define PROBING_FANS_OFF          // Turn fans off when probing
 
+// Shorten the time spent probing the bed.
+// The raise between points follows the bed deviation measured so far plus
+// PROBE_RAISE_MARGIN (never more than Z_PROBE_BETWEEN_HEIGHT), UBL walks the
+// mesh to the nearest unprobed point and G29 starts probing as soon as all
+// heaters are within PROBE_HEATING_WINDOW of their target.
+// Start script example: M140 S60, M104 S200, G28, G29, M190 S60, M109 S200
+//#define PROBE_SEQUENCE_OPTIMIZATION
+#define PROBE_RAISE_MARGIN    2 // (mm) Clearance added to the measured bed deviation
+#define PROBE_HEATING_WINDOW  5 // (°C) Start probing when the heaters are this close to the target
+
 // Add a bed leveling sub-menu for ABL or MBL.
 // Include a guided procedure if manual probing is enabled.
 //#define LCD_BED_LEVELING
@@ -445,6 +461,13 @@
 
 // When the nozzle is off the mesh, this value is used as the Z-Height correction value.
 //#define UBL_Z_RAISE_WHEN_OFF_MESH 2.5
+
+// Store the meshes as int16 microns from a best-fit plane with a validity
+// bitmap and a CRC, about half the size of the float mesh so more slots fit.
+//#define UBL_COMPACT_MESH
+// Extra mesh slots stored on the SD card (meshNN.dat), numbered after the EEPROM slots.
+// Requires UBL_COMPACT_MESH and SDSUPPORT. 0 to disable.
+#define UBL_MESH_SD_SLOTS 0
 /** END Unified Bed Leveling */
 
 // Set the number of grid points per dimension
@@ -461,6 +484,18 @@
 // Number of subdivisions between probe points
 #define BILINEAR_SUBDIVISIONS 3
 
+// Bicubic (Catmull-Rom) interpolation of the probed grid.
+// 16 coefficients per cell are computed when the mesh changes, giving a smooth
+// surface from a sparse grid without the RAM of the subdivided grid.
+// RAM: (GRID_MAX_POINTS_X - 1) * (GRID_MAX_POINTS_Y - 1) * 64 bytes
+//#define ABL_BICUBIC_INTERPOLATION
+
+// Adaptive mesh: G29 U probes only the grid points under the print area plus a margin
+// and keeps the stored mesh for the other points.
+// The print area is set with G29 U L R F B or read from the header of the SD file (Cura ;MINX ;MINY ;MAXX ;MAXY).
+//#define ADAPTIVE_MESH_LEVELING
+#define ADAPTIVE_MESH_MARGIN 10   // (mm)
+
 // Commands to execute at the end of G29 probing.
 // Useful to retract or move the Z probe out of the way.
 //#define Z_PROBE_END_SCRIPT "G1 Z10 F8000\nG1 X10 Y10\nG1 Z0.5"
@@ -1373,7 +1373,8 @@
  * compiler to calculate the worst-case usage and throw an error if the SRAM
  * limit is exceeded.
  *
- *  - SDSORT_USES_RAM provides faster sorting via a static directory buffer.
+ *  - SDSORT_USES_RAM provides faster sorting via a static directory buffer,
+ *    the names packed one after the other in a pool of SDSORT_POOL_SIZE bytes.
  *  - SDSORT_USES_STACK does the same, but uses a local stack-based buffer.
  *  - SDSORT_CACHE_NAMES will retain the sorted file listing in RAM. (Expensive!)
  *  - SDSORT_DYNAMIC_RAM only uses RAM when the SD menu is visible. (Use with caution!)
@@ -1381,7 +1382,7 @@
 //#define SDCARD_SORT_ALPHA
 
 // SD Card Sorting options
-#define SDSORT_LIMIT       40     // Maximum number of sorted items (10-256). Costs 27 bytes each.
+#define SDSORT_LIMIT       40     // Maximum number of sorted items (10-256). Costs 1 byte each, 3 with SDSORT_USES_RAM.
 #define FOLDER_SORTING     -1     // -1=above  0=none  1=below
 #define SDSORT_GCODE       false  // Allow turning sorting on/off with LCD and M36 g-code.
 #define SDSORT_USES_RAM    false  // Pre-allocate a static array for faster pre-sorting.
@@ -1390,12 +1391,50 @@
 #define SDSORT_DYNAMIC_RAM false  // Use dynamic allocation (within SD menus). Least expensive option. Set SDSORT_LIMIT before use!
 #define SDSORT_CACHE_VFATS 2      // Maximum number of 13-byte VFAT entries to use for sorting.
                                   // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
+#define SDSORT_POOL_SIZE   1024   // Bytes for the names with SDSORT_USES_RAM. Files after a full pool are left unsorted.
+
+// Remember where each page of files starts in the working directory and the number of files,
+// so the SD menu and the file lookups by index read at most one page of directory entries.
+// The index is flushed when the working directory or its content changes.
+//#define SD_DIR_INDEX
+#define SD_DIR_INDEX_PAGE_SIZE 16 // Files for page
+#define SD_DIR_INDEX_PAGES     32 // Pages remembered. Costs 4 bytes each.
+
+// Print files stored on contiguous clusters with multi-block reads (CMD18) of
+// SD_CONTIGUOUS_READ_BLOCKS blocks at a time into a buffer, without FAT lookups.
+// Other files are read as usual. Only for 32 bit boards, costs 512 bytes for block.
+//#define SD_CONTIGUOUS_READ
+#define SD_CONTIGUOUS_READ_BLOCKS 4
+
+// Cache the values read from the header of the jobs (filament, heights, slicer and
+// the print area for ADAPTIVE_MESH_LEVELING) in the hidden file .jobmeta of the folder,
+// so a selected file already seen is not read again. Needs JSON_OUTPUT or ADAPTIVE_MESH_LEVELING.
+//#define SD_JOB_META_CACHE
+#define SD_JOB_META_SLOTS 32      // Records in each .jobmeta file
+
+// Binary upload to SD with M28 B<bytes> <filename>.
+// The host sends length-prefixed chunks of 512 bytes checked with CRC16 and
+// every chunk is acknowledged, instead of one numbered G-code line at a time.
+//#define BINARY_FILE_UPLOAD
+
+// Create new files written with M28 on SD_PREALLOCATE_SIZE bytes of contiguous clusters,
+// truncated to the written size when closed. Writes don't extend the FAT one cluster at a time.
+// An existing file is appended as usual.
+//#define SD_PREALLOCATE_WRITE
+#define SD_PREALLOCATE_SIZE 4194304 // Bytes
+
+// Queue the data written with M28 and the binary upload in a RAM buffer of
+// SD_IO_WORKER_BUFFER bytes. The idle loop writes it to the card one block at a time,
+// so a slow card doesn't hold command processing.
+//#define SD_IO_WORKER
+#define SD_IO_WORKER_BUFFER 2048    // Bytes, a multiple of 512
 
 // This function enable the firmware write restart file for restart print when power loss
 //#define SD_RESTART_FILE               // Uncomment to enable
 #define SD_RESTART_FILE_SAVE_TIME    1  // Seconds between update
 #define SD_RESTART_FILE_PURGE_LEN   20  // Purge when restart
 #define SD_RESTART_FILE_RETRACT_LEN  1  // Retract when restart
+#define SD_RESTART_JOURNAL_RECORDS 128  // Records preallocated in the restart file after the job snapshot
 /*****************************************************************************************/
 
 
@@ -84,6 +84,11 @@
 // If movement is choppy try lowering this value
 #define SCARA_SEGMENTS_PER_SECOND 100
 
+// Split moves by the curvature of the arm motion instead of by time, so the
+// straight arm moves stay within this distance (mm) of the Cartesian line.
+// The rate set by SCARA_SEGMENTS_PER_SECOND becomes the upper limit.
+//#define KINEMATIC_SEGMENT_DEVIATION 0.01
+
 // Precise lengths of inner (shoulder) and outer (elbow) support arms
 #define SCARA_LINKAGE_1 200 // mm
 #define SCARA_LINKAGE_2 200 // mm
@@ -104,6 +109,10 @@
 // Enable this if your SCARA uses 180° of total area
 //#define EXTRAPOLATE_FROM_EDGE
 
+// Use a polynomial atan2 in the SCARA kinematics instead of the libm one.
+// Worst-case angular error is 2e-6 rad (0.0002°), well below one motor step.
+//#define SCARA_FAST_TRIG
+
 /*****************************************************************************************/
 
 
@@ -256,6 +265,16 @@
 //#define PROBING_HEATERS_OFF       // Turn heaters off when probing
 //#define PROBING_FANS_OFF          // Turn fans off when probing
 
+// Shorten the time spent probing the bed.
+// The raise between points follows the bed deviation measured so far plus
+// PROBE_RAISE_MARGIN (never more than Z_PROBE_BETWEEN_HEIGHT), UBL walks the
+// mesh to the nearest unprobed point and G29 starts probing as soon as all
+// heaters are within PROBE_HEATING_WINDOW of their target.
+// Start script example: M140 S60, M104 S200, G28, G29, M190 S60, M109 S200
+//#define PROBE_SEQUENCE_OPTIMIZATION
+#define PROBE_RAISE_MARGIN    2 // (mm) Clearance added to the measured bed deviation
+#define PROBE_HEATING_WINDOW  5 // (°C) Start probing when the heaters are this close to the target
+
 // Add a bed leveling sub-menu for ABL or MBL.
 // Include a guided procedure if manual probing is enabled.
 //#define LCD_BED_LEVELING
@@ -472,6 +491,18 @@
 //#define ABL_BILINEAR_SUBDIVISION
 // Number of subdivisions between probe points
 #define BILINEAR_SUBDIVISIONS 3
+
+// Bicubic (Catmull-Rom) interpolation of the probed grid.
+// 16 coefficients per cell are computed when the mesh changes, giving a smooth
+// surface from a sparse grid without the RAM of the subdivided grid.
+// RAM: (GRID_MAX_POINTS_X - 1) * (GRID_MAX_POINTS_Y - 1) * 64 bytes
+//#define ABL_BICUBIC_INTERPOLATION
+
+// Adaptive mesh: G29 U probes only the grid points under the print area plus a margin
+// and keeps the stored mesh for the other points.
+// The print area is set with G29 U L R F B or read from the header of the SD file (Cura ;MINX ;MINY ;MAXX ;MAXY).
+//#define ADAPTIVE_MESH_LEVELING
+#define ADAPTIVE_MESH_MARGIN 10   // (mm)
 /** END AUTO_BED_LEVELING_LINEAR or AUTO_BED_LEVELING_BILINEAR **/
 
 /** START AUTO_BED_LEVELING_3POINT **/
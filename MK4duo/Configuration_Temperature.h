@@ -38,6 +38,9 @@
  * - PID Settings - COOLER
  * - Inverted PINS
  * - Thermal runaway protection
+ * - Heater telemetry
+ * - Heaters power
+ * - Concurrent preheat
  * - Prevent cold extrusion
  * - Safety timer
  *
@@ -116,6 +119,12 @@
 #define TEMP_SENSOR_AD595_OFFSET 0.0
 #define TEMP_SENSOR_AD595_GAIN   1.0
 
+// Enable this for a piecewise linear calibration table for each sensor.
+// The table corrects the sensor temperature with the points measured with a reference probe.
+// Set the points with M309 (two-point field calibration or a table from SD) and save with M500.
+//#define SENSOR_CALIBRATION
+#define SENSOR_CALIBRATION_POINTS 8   // Max 16, each point uses 4 bytes for each heater
+
 // Use it for Testing or Development purposes. NEVER for production machine.
 #define DUMMY_THERMISTOR_998_VALUE  25
 #define DUMMY_THERMISTOR_999_VALUE 100
@@ -442,6 +451,71 @@
 /********************************************************************************/
 
 
+/***********************************************************************
+ ************************* Heater telemetry ****************************
+ ***********************************************************************
+ *                                                                     *
+ * Keep a RAM ring for each heater with the last samples of            *
+ * temperature, target, PWM output and P I D terms, one sample every   *
+ * control cycle (100ms).                                              *
+ * The ring is frozen when a heater error or a thermal runaway         *
+ * occurs, so the data that led to the error is not overwritten.       *
+ * Use M310 H[heater] to dump the ring as CSV, M310 R to restart it.   *
+ *                                                                     *
+ * Each sample uses 14 bytes of RAM for each heater (13 on AVR).       *
+ *                                                                     *
+ ***********************************************************************/
+//#define HEATER_TELEMETRY
+#define HEATER_TELEMETRY_SAMPLES 60   // Max 255
+/***********************************************************************/
+
+
+/***********************************************************************
+ ************************** Heaters power ******************************
+ ***********************************************************************
+ *                                                                     *
+ * Nominal power of each heater and max power the PSU can give to all  *
+ * heaters together. Used by Concurrent preheat and Power arbiter.     *
+ *                                                                     *
+ * Enable HEATERS POWER ARBITER to limit the total power of hotends,   *
+ * beds and chambers to HEATERS POWER BUDGET at every control cycle.   *
+ * When the heaters ask for more, the budget is divided by priority    *
+ * and by the error of each heater from its target.                    *
+ * Use M311 to see the power and the time spent over the budget.       *
+ *                                                                     *
+ ***********************************************************************/
+#define HOTEND_WATTS          40    // (W)
+#define BED_WATTS            250    // (W)
+#define CHAMBER_WATTS        300    // (W)
+#define HEATERS_POWER_BUDGET 400    // (W)
+
+//#define HEATERS_POWER_ARBITER
+#define HOTEND_POWER_PRIORITY   4   // Weight of the hotends
+#define BED_POWER_PRIORITY      2   // Weight of the beds
+#define CHAMBER_POWER_PRIORITY  1   // Weight of the chambers
+/***********************************************************************/
+
+
+/***********************************************************************
+ ************************ Concurrent preheat ***************************
+ ***********************************************************************
+ *                                                                     *
+ * M116 waits for all heaters with a target at once.                   *
+ * The heating time of each heater is predicted from its heating rate, *
+ * measured at full power, and the heaters are started one by one so   *
+ * that all reach the target together with the slowest one, without    *
+ * going over HEATERS POWER BUDGET.                                    *
+ * In the start gcode use: M140 S60, M104 S200, M116                   *
+ *                                                                     *
+ ***********************************************************************/
+//#define CONCURRENT_PREHEAT
+#define PREHEAT_HOTEND_RATE   2.0   // (degC/s) Heating rate used before it is measured
+#define PREHEAT_BED_RATE      0.5   // (degC/s)
+#define PREHEAT_CHAMBER_RATE  0.1   // (degC/s)
+#define PREHEAT_START_LEAD    5     // (s) Start a heater earlier by this time
+/***********************************************************************/
+
+
 /***********************************************************************
  ************************ Prevent cold extrusion ***********************
  ***********************************************************************
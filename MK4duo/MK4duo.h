@@ -154,6 +154,8 @@
 
 // SDCARD modules
 #include "src/sdcard/sdcard.h"
+#include "src/sdcard/sdupload.h"
+#include "src/sdcard/sdworker.h"
 
 // Feature modules
 #include "src/feature/emergency_parser/emergency_parser.h"
@@ -165,6 +167,7 @@
 #include "src/feature/hysteresis/hysteresis.h"
 #include "src/feature/tmc/tmc.h"
 #include "src/feature/power/power.h"
+#include "src/feature/powerarbiter/powerarbiter.h"
 #include "src/feature/mixing/mixing.h"
 #include "src/feature/mmu2/mmu2.h"
 #include "src/feature/filament/filament.h"
@@ -321,6 +321,14 @@ void Commands::get_serial() {
     }
   #endif
 
+  // Chunks of a binary upload bypass the line reader
+  #if ENABLED(BINARY_FILE_UPLOAD)
+    if (sdupload.isActive()) {
+      sdupload.receive();
+      return;
+    }
+  #endif
+
   // If the command buffer is empty for too long,
   // send "wait" to indicate MK4duo is still waiting.
   #if NO_TIMEOUTS > 0
@@ -541,7 +549,7 @@ void Commands::get_serial() {
         sd_line_buffer[sd_count] = '\0'; // terminate string
         sd_count = 0; // clear sd line buffer
 
-        enqueue(sd_line_buffer, false, -2); // Port -2 for SD non answer and no send ok.
+        enqueue(sd_line_buffer, false, -2, card.getIndex() + 1); // Port -2 for SD non answer and no send ok.
 
       }
       else if (sd_count >= MAX_CMD_SIZE - 1) {
@@ -576,6 +584,11 @@ void Commands::process_next() {
   parser.parse(cmd.gcode);
   process_parsed();
 
+  #if HAS_SD_RESTART
+    // A restart resumes after the last SD command run
+    if (cmd.sdpos) restart.cmd_sdpos = cmd.sdpos;
+  #endif
+
 }
 
 void Commands::unknown_error() {
@@ -615,12 +628,17 @@ bool Commands::enqueue_one(const char * cmd) {
   return false;
 }
 
-bool Commands::enqueue(const char * cmd, bool say_ok/*=false*/, int8_t port/*=-2*/) {
+bool Commands::enqueue(const char * cmd, bool say_ok/*=false*/, int8_t port/*=-2*/, const uint32_t sdpos/*=0*/) {
   if (*cmd == ';' || buffer_ring.isFull()) return false;
   gcode_t temp_cmd;
   strcpy(temp_cmd.gcode, cmd);
   temp_cmd.s_port = port;
   temp_cmd.send_ok = say_ok;
+  #if HAS_SD_RESTART
+    temp_cmd.sdpos = sdpos;
+  #else
+    UNUSED(sdpos);
+  #endif
   buffer_ring.enqueue(temp_cmd);
   return true;
 }
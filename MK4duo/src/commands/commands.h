@@ -35,6 +35,9 @@ struct gcode_t {
   int8_t  s_port  = -1;         // Serial port for print information:
                                 //    -1 for all port
                                 //    -2 for SD or null port
+  #if HAS_SD_RESTART
+    uint32_t sdpos = 0;         // SD file position after the line, 0 if not from SD
+  #endif
 };
 
 class Commands {
@@ -219,7 +222,7 @@ class Commands {
      * Return true if the command was successfully added.
      * Return false for a full buffer, or if the 'command' is a comment.
      */
-    static bool enqueue(const char * cmd, bool say_ok=false, int8_t port=-2);
+    static bool enqueue(const char * cmd, bool say_ok=false, int8_t port=-2, const uint32_t sdpos=0);
 
     /**
      * Process the next "immediate" command
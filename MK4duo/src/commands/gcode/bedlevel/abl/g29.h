@@ -96,6 +96,12 @@ void out_of_range_error(PGM_P p_edge) {
  *
  *  Z  Supply an additional Z probe offset
  *
+ *  U  Adaptive mesh (ADAPTIVE_MESH_LEVELING). Probe only the grid points
+ *     under the print area plus ADAPTIVE_MESH_MARGIN, keep the stored mesh
+ *     or extend the probed area for the other points.
+ *     With U the parameters L R F B set the print area, otherwise
+ *     the print area read from the header of the SD file is used.
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -220,6 +226,14 @@ inline void gcode_G29(void) {
 
       ABL_VAR float zoffset = 0.0;
 
+      #if ENABLED(ADAPTIVE_MESH_LEVELING)
+        bool    adaptive    = false;
+        uint8_t area_min_x  = 0,
+                area_max_x  = GRID_MAX_POINTS_X - 1,
+                area_min_y  = 0,
+                area_max_y  = GRID_MAX_POINTS_Y - 1;
+      #endif
+
     #elif ENABLED(AUTO_BED_LEVELING_LINEAR)
 
       ABL_VAR int indexIntoAB[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
@@ -292,6 +306,8 @@ inline void gcode_G29(void) {
           abl.z_values[i][j] = rz;
           #if ENABLED(ABL_BILINEAR_SUBDIVISION)
             abl.virt_interpolate();
+          #elif ENABLED(ABL_BICUBIC_INTERPOLATION)
+            abl.bicubic_interpolate();
           #endif
           bedlevel.set_bed_leveling_enabled(abl_should_enable);
           if (abl_should_enable) mechanics.report_current_position();
@@ -347,6 +363,10 @@ inline void gcode_G29(void) {
 
       zoffset = parser.linearval('Z');
 
+      #if ENABLED(ADAPTIVE_MESH_LEVELING)
+        adaptive = parser.seen('U');
+      #endif
+
     #endif
 
     #if ABL_GRID
@@ -358,6 +378,22 @@ inline void gcode_G29(void) {
       front_probe_bed_position = parser.seenval('F') ? (int)NATIVE_Y_POSITION(parser.value_linear_units()) : FRONT_PROBE_BED_POSITION;
       back_probe_bed_position  = parser.seenval('B') ? (int)NATIVE_Y_POSITION(parser.value_linear_units()) : BACK_PROBE_BED_POSITION;
 
+      #if ENABLED(ADAPTIVE_MESH_LEVELING)
+        if (adaptive) {
+          // L R F B are the print area, the grid stays on the whole bed
+          if (parser.seen("LRFB"))
+            bedlevel.set_print_area(left_probe_bed_position, front_probe_bed_position, right_probe_bed_position, back_probe_bed_position);
+          if (!bedlevel.flag.print_area) {
+            SERIAL_EM("?No print area for (U) adaptive mesh.");
+            return;
+          }
+          left_probe_bed_position  = LEFT_PROBE_BED_POSITION;
+          right_probe_bed_position = RIGHT_PROBE_BED_POSITION;
+          front_probe_bed_position = FRONT_PROBE_BED_POSITION;
+          back_probe_bed_position  = BACK_PROBE_BED_POSITION;
+        }
+      #endif
+
       if (
         #if IS_KINEMATIC
              !mechanics.position_is_reachable_by_probe(left_probe_bed_position, 0)
@@ -377,6 +413,22 @@ inline void gcode_G29(void) {
       xGridSpacing = (right_probe_bed_position - left_probe_bed_position) / (abl_grid_points_x - 1);
       yGridSpacing = (back_probe_bed_position - front_probe_bed_position) / (abl_grid_points_y - 1);
 
+      #if ENABLED(ADAPTIVE_MESH_LEVELING)
+        if (adaptive) {
+          // Grid points of the cells under the print area plus the margin
+          area_min_x = constrain(int(FLOOR((bedlevel.print_area_min[X_AXIS] - (ADAPTIVE_MESH_MARGIN) - left_probe_bed_position) / xGridSpacing)), 0, GRID_MAX_POINTS_X - 1);
+          area_max_x = constrain(int(CEIL((bedlevel.print_area_max[X_AXIS] + (ADAPTIVE_MESH_MARGIN) - left_probe_bed_position) / xGridSpacing)), 0, GRID_MAX_POINTS_X - 1);
+          area_min_y = constrain(int(FLOOR((bedlevel.print_area_min[Y_AXIS] - (ADAPTIVE_MESH_MARGIN) - front_probe_bed_position) / yGridSpacing)), 0, GRID_MAX_POINTS_Y - 1);
+          area_max_y = constrain(int(CEIL((bedlevel.print_area_max[Y_AXIS] + (ADAPTIVE_MESH_MARGIN) - front_probe_bed_position) / yGridSpacing)), 0, GRID_MAX_POINTS_Y - 1);
+          if (verbose_level > 0) {
+            SERIAL_MV("Adaptive mesh X", (int)area_min_x);
+            SERIAL_MV("-", (int)area_max_x);
+            SERIAL_MV(" Y", (int)area_min_y);
+            SERIAL_EMV("-", (int)area_max_y);
+          }
+        }
+      #endif
+
     #endif // ABL_GRID
 
     if (verbose_level > 0) {
@@ -620,6 +672,13 @@ inline void gcode_G29(void) {
 
     measured_z = 0.0;
 
+    #if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+      #if HEATER_COUNT > 0
+        thermalManager.wait_heaters_near_target(PROBE_HEATING_WINDOW);
+      #endif
+      probe.begin_sequence();
+    #endif
+
     #if ABL_GRID
 
       bool zig = PR_OUTER_END & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
@@ -660,6 +719,11 @@ inline void gcode_G29(void) {
             if (!mechanics.position_is_reachable_by_probe(xProbe, yProbe)) continue;
           #endif
 
+          #if ENABLED(ADAPTIVE_MESH_LEVELING)
+            // Skip the points out of the print area
+            if (adaptive && (!WITHIN(xCount, area_min_x, area_max_x) || !WITHIN(yCount, area_min_y, area_max_y))) continue;
+          #endif
+
           measured_z = faux ? 0.001 * random(-100, 101) : probe.check_pt(xProbe, yProbe, raise_after, verbose_level);
 
           if (isnan(measured_z)) {
@@ -751,6 +815,16 @@ inline void gcode_G29(void) {
   if (!isnan(measured_z)) {
     #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
+      #if ENABLED(ADAPTIVE_MESH_LEVELING)
+        // Points out of the print area without a stored mesh: extend the edges of the area
+        if (adaptive && !dryrun) {
+          for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+            for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+              if (isnan(abl.z_values[x][y]))
+                abl.z_values[x][y] = abl.z_values[constrain(x, area_min_x, area_max_x)][constrain(y, area_min_y, area_max_y)];
+        }
+      #endif
+
       if (!dryrun) abl.extrapolate_unprobed_bed_level();
       abl.print_bilinear_leveling_grid();
 
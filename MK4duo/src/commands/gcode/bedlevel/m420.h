@@ -156,6 +156,8 @@ inline void gcode_M420(void) {
                 Z_VALUES(x, y) -= zmean;
             #if ENABLED(ABL_BILINEAR_SUBDIVISION)
               abl.virt_interpolate();
+            #elif ENABLED(ABL_BICUBIC_INTERPOLATION)
+              abl.bicubic_interpolate();
             #endif
           }
 
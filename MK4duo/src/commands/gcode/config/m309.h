@@ -0,0 +1,83 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ */
+
+#if HEATER_COUNT > 0 && ENABLED(SENSOR_CALIBRATION)
+
+#define CODE_M309
+
+/**
+ * M309: Set sensor calibration table
+ *
+ *   H[heaters] H = 0-5 Hotend, H = -1 BED, H = -2 CHAMBER, H = -3 COOLER
+ *
+ *    T[int]      0-3 For Select Beds or Chambers
+ *
+ *    A[float]  Actual temperature read with a reference probe
+ *    P[float]  Sensor temperature of the point (default the current sensor reading)
+ *    R         Clear the table
+ *
+ *  Two-point field calibration:
+ *    Heat to a low temperature and wait, M309 H0 A<reference temperature>
+ *    Heat to a high temperature and wait, M309 H0 A<reference temperature>
+ *    M500 for save in EEPROM
+ *
+ *  A full table can be loaded from a file on SD with lines M309 H0 P<sensor> A<actual>
+ */
+inline void gcode_M309(void) {
+
+  Heater *act = commands.get_target_heater();
+
+  if (!act) return;
+
+  #if DISABLED(DISABLE_M503)
+    // No arguments? Show M309 report.
+    if (!parser.seen("AR")) {
+      act->print_M309();
+      return;
+    }
+  #endif
+
+  if (parser.seen('R')) {
+    act->data.sensor.reset_cal();
+    if (!parser.seen('A')) return;
+  }
+
+  if (parser.seenval('A')) {
+    const float actual    = parser.value_celsius(),
+                measured  = parser.floatval('P', act->data.sensor.getSensorTemperature());
+
+    CRITICAL_SECTION_START
+    const bool added = act->data.sensor.set_cal_point(measured, actual);
+    CRITICAL_SECTION_END
+
+    if (!added) SERIAL_LM(ER, "Sensor calibration table full");
+  }
+
+}
+
+#endif // HEATER_COUNT > 0 && ENABLED(SENSOR_CALIBRATION)
@@ -127,6 +127,8 @@ static void Adjust(const uint8_t numFactors, const float v[]) {
 
 /**
  * Delta AutoCalibration Algorithm of Minor Squares based on DC42 RepRapFirmware 7 points
+ * The bed is probed once, then Gauss-Newton iterations are done on the
+ * same data until the expected deviation stops improving.
  * Usage:
  *    G33 <Fn> <Pn> <Q>
  *      F = Num Factors 3 or 4 or 6 or 7
@@ -142,21 +144,25 @@ inline void gcode_G33(void) {
   const uint8_t MaxCalibrationPoints  = 10,
                 NperifericalPoints    = 6,
                 NinternalPoints       = 3,
-                MaxnumFactors         = 7;
+                MaxnumFactors         = 7,
+                MaxIterations         = 6;
+
+  constexpr float ConvergedRmsChange  = 0.0005; // (mm) Stop when the deviation improves less than this
 
   uint8_t iteration = 0;
 
   float   xBedProbePoints[MaxCalibrationPoints],
           yBedProbePoints[MaxCalibrationPoints],
           zBedProbePoints[MaxCalibrationPoints],
+          expectedResiduals[MaxCalibrationPoints],
           initialSumOfSquares,
           expectedRmsError;
 
   char    rply[50];
 
   const uint8_t numFactors = parser.intval('F', DELTA_AUTO_CALIBRATION_1_DEFAULT_FACTOR);
-  if (!WITHIN(numFactors, 3, 7)) {
-    SERIAL_EM("?(F)actors is implausible (3 to 7).");
+  if (!WITHIN(numFactors, 3, 7) || numFactors == 5) {
+    SERIAL_EM("?(F)actors is implausible (3, 4, 6 or 7).");
     return;
   }
 
@@ -210,6 +216,7 @@ inline void gcode_G33(void) {
   float corrections[MaxCalibrationPoints];
 
   initialSumOfSquares = 0.0;
+  expectedRmsError = 0.0;
 
   // Transform the probing points to motor endpoints and store them in a matrix, so that we can do multiple iterations using the same data
   for (uint8_t i = 0; i < probe_points; ++i) {
@@ -224,9 +231,11 @@ inline void gcode_G33(void) {
     initialSumOfSquares += sq(zBedProbePoints[i]);
   }
 
-  // Do 1 or more Newton-Raphson iterations
+  // Do Newton-Raphson iterations on the probed data until the deviation converges
   do {
 
+    const float previousRmsError = iteration ? expectedRmsError : SQRT(initialSumOfSquares / probe_points);
+
     // Build a Nx9 matrix of derivatives
     FixedMatrix<float, MaxCalibrationPoints, MaxnumFactors> derivativeMatrix;
 
@@ -309,7 +318,6 @@ inline void gcode_G33(void) {
     Adjust(numFactors, solution);
 
     // Calculate the expected probe heights using the new parameters
-    float expectedResiduals[MaxCalibrationPoints];
     float sumOfSquares = 0.0;
 
     for (int8_t i = 0; i < probe_points; i++) {
@@ -324,7 +332,15 @@ inline void gcode_G33(void) {
     expectedRmsError = SQRT((float)(sumOfSquares / probe_points));
 
     ++iteration;
-  } while (iteration < 2);
+
+    if (g33_debug) {
+      SERIAL_MV("Iteration ", iteration);
+      SERIAL_EMV(" deviation ", expectedRmsError, 4);
+    }
+
+    if (iteration >= 2 && ABS(previousRmsError - expectedRmsError) < ConvergedRmsChange) break;
+
+  } while (iteration < MaxIterations);
 
   // convert data.endstop_adj;
   Convert_endstop_adj();
@@ -333,6 +349,11 @@ inline void gcode_G33(void) {
   SERIAL_MV(" factors using ", probe_points);
   SERIAL_MV(" points, deviation before ", SQRT(initialSumOfSquares / probe_points), 4);
   SERIAL_MV(" after ", expectedRmsError, 4);
+  SERIAL_MV(" in ", iteration);
+  SERIAL_EM(" iterations");
+
+  SERIAL_MSG("Residuals:");
+  for (uint8_t i = 0; i < probe_points; i++) SERIAL_MV(" ", expectedResiduals[i], 3);
   SERIAL_EOL();
 
   mechanics.recalc_delta_settings();
@@ -36,6 +36,9 @@
  *  X[float] Sets the hysteresis distance on X (0 to disable)
  *  Y[float] Sets the hysteresis distance on Y (0 to disable)
  *  Z[float] Sets the hysteresis distance on Z (0 to disable)
+ *  I[float] Sets the smoothing distance on X (0 = whole correction in one block)
+ *  J[float] Sets the smoothing distance on Y (0 = whole correction in one block)
+ *  K[float] Sets the smoothing distance on Z (0 = whole correction in one block)
  *
  */
 inline void gcode_M99(void) {
@@ -43,6 +46,8 @@ inline void gcode_M99(void) {
   LOOP_XYZ(axis) {
     if (parser.seen(axis_codes[axis]))
       hysteresis.mm[axis] = parser.value_float();
+    if (parser.seen("IJK"[axis]))
+      hysteresis.smoothing_mm[axis] = MAX(0, parser.value_float());
   }
 
   if (parser.seen('F'))
@@ -60,6 +65,11 @@ inline void gcode_M99(void) {
   SERIAL_MV(" Y", hysteresis.mm[Y_AXIS]);
   SERIAL_MV(" Z", hysteresis.mm[Z_AXIS]);
   SERIAL_EOL();
+  SERIAL_MSG("  Smoothing Distance (mm): ");
+  SERIAL_MV(" I", hysteresis.smoothing_mm[X_AXIS]);
+  SERIAL_MV(" J", hysteresis.smoothing_mm[Y_AXIS]);
+  SERIAL_MV(" K", hysteresis.smoothing_mm[Z_AXIS]);
+  SERIAL_EOL();
 
 }
 
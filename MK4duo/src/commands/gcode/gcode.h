@@ -64,6 +64,7 @@
 #include "config/m302.h"                  // Allow cold extrudes
 #include "config/m305.h"                  // Set thermistor and ADC parameters
 #include "config/m306.h"                  // Set Heaters
+#include "config/m309.h"                  // Set sensor calibration table
 #include "config/m595.h"                  // Set AD595 offset & Gain
 #include "config/m569.h"                  // Set Stepper Direction
 #include "config/m900.h"                  // Set and/or Get advance K factor
@@ -249,6 +250,8 @@
 #include "temperature/m191.h"
 #include "temperature/m192.h"
 #include "temperature/m303.h"             // PID autotune
+#include "temperature/m310.h"             // Heater telemetry
+#include "temperature/m311.h"             // Heaters power arbiter
 
 // Tools Commands
 #include "tools/tcode.h"
@@ -33,8 +33,27 @@
 
 /**
  * M28: Start SD Write
+ *
+ *  M28 B<bytes> <filename> starts a binary upload of a file of the given size
  */
-inline void gcode_M28(void) { card.startWrite(parser.string_arg, false); }
+inline void gcode_M28(void) {
+
+  #if ENABLED(BINARY_FILE_UPLOAD)
+    char *arg = parser.string_arg;
+    if (arg[0] == 'B' && NUMERIC(arg[1])) {
+      char *fname;
+      const uint32_t size = strtoul(arg + 1, &fname, 10);
+      if (*fname == ' ') {
+        while (*fname == ' ') fname++;
+        sdupload.start(fname, size, commands.buffer_ring.peek().s_port);
+        return;
+      }
+    }
+  #endif
+
+  card.startWrite(parser.string_arg, false);
+
+}
 
 /**
  * M29: Stop SD Write
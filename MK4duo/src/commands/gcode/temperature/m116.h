@@ -32,16 +32,23 @@
 
 /**
  * M116: Wait for all heaters to reach target temperature
+ *
+ *  With CONCURRENT_PREHEAT all heaters are waited at once and started
+ *  one by one so they reach the target together within HEATERS_POWER_BUDGET.
  */
 inline void gcode_M116(void) {
-  #if HOTENDS > 0
-    LOOP_HOTEND() hotends[h].wait_for_target(true);
-  #endif
-  #if BEDS > 0
-    LOOP_BED() beds[h].wait_for_target(true);
-  #endif
-  #if CHAMBERS > 0
-    LOOP_CHAMBER() chambers[h].wait_for_target(true);
+  #if ENABLED(CONCURRENT_PREHEAT)
+    thermalManager.wait_heaters_concurrent();
+  #else
+    #if HOTENDS > 0
+      LOOP_HOTEND() hotends[h].wait_for_target(true);
+    #endif
+    #if BEDS > 0
+      LOOP_BED() beds[h].wait_for_target(true);
+    #endif
+    #if CHAMBERS > 0
+      LOOP_CHAMBER() chambers[h].wait_for_target(true);
+    #endif
   #endif
 }
 
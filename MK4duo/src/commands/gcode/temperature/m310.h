@@ -0,0 +1,65 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ */
+
+#if HEATER_COUNT > 0 && ENABLED(HEATER_TELEMETRY)
+
+#define CODE_M310
+
+/**
+ * M310: Heater telemetry
+ *
+ *   H[heaters] H = 0-5 Hotend, H = -1 BED, H = -2 CHAMBER, H = -3 = COOLER
+ *
+ *    T[int]      0-3 For Select Beds or Chambers
+ *
+ *    S[bool]   Freeze (S1) or restart (S0) the sampling
+ *    R         Clear the ring and restart the sampling
+ *
+ *  With no S or R parameter dump the ring as CSV:
+ *    ms,temp,target,pwm,p,i,d
+ */
+inline void gcode_M310(void) {
+
+  Heater *act = commands.get_target_heater();
+
+  if (!act) return;
+
+  if (parser.seen('R'))
+    act->telemetry.reset();
+  else if (parser.seen('S')) {
+    if (parser.value_bool())
+      act->telemetry.freeze();
+    else
+      act->telemetry.reset();
+  }
+  else
+    act->telemetry.dump();
+
+}
+
+#endif // HEATER_COUNT > 0 && ENABLED(HEATER_TELEMETRY)
@@ -0,0 +1,51 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ */
+
+#if ENABLED(HEATERS_POWER_ARBITER)
+
+#define CODE_M311
+
+/**
+ * M311: Heaters power arbiter
+ *
+ *    S[int]    Set the power budget for all heaters (W)
+ *    R         Reset the saturation time
+ *
+ *  Report the budget, the power requested and granted
+ *  and the time spent over the budget.
+ */
+inline void gcode_M311(void) {
+
+  if (parser.seenval('S')) powerArbiter.budget = parser.value_ushort();
+  if (parser.seen('R')) powerArbiter.reset();
+
+  powerArbiter.report();
+
+}
+
+#endif // ENABLED(HEATERS_POWER_ARBITER)
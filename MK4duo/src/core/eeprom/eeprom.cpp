@@ -26,9 +26,10 @@
  * Configuration and EEPROM storage
  *
  * IMPORTANT:  Whenever there are changes made to the variables stored in EEPROM
- * in the functions below, also increment the version number. This makes sure that
- * the default values are used whenever there is a change to the data, to prevent
- * wrong data being written to the variables.
+ * in the functions below, also increment the version number of their section.
+ * This makes sure that the default values are used whenever there is a change
+ * to the data, to prevent wrong data being written to the variables.
+ * The other sections keep their stored values.
  *
  * ALSO: Variables in the Store and Retrieve sections must be in the same order.
  *       If a feature is disabled, some data must still be written that, when read,
@@ -50,13 +51,37 @@
  * Keep this data structure up to date so
  * EEPROM size is known at compile time!
  */
-#define EEPROM_VERSION "MKV68"
+#define EEPROM_VERSION "MKV69"
 #define EEPROM_OFFSET 100
 
+/**
+ * Section versions, each section is checked and reset on its own
+ */
+#define EEPROM_MECHANICS_VERSION  1
+#define EEPROM_HEATERS_VERSION    1
+#define EEPROM_LEVELING_VERSION   1
+#define EEPROM_LCD_VERSION        1
+#define EEPROM_FEATURES_VERSION   1
+#define EEPROM_TMC_VERSION        1
+
+typedef struct {
+  uint8_t   version,      // Section version
+            reserved;
+  uint16_t  size,         // Data size, to find the next section
+            crc,          // Data Checksum
+            pad;          // Pad the header to 8 bytes
+} eeprom_section_t;
+
+static_assert(sizeof(eeprom_section_t) == 8, "EEPROM section header must be 8 bytes.");
+
 typedef struct EepromDataStruct {
 
   char      version[6];   // MKVnn\0
-  uint16_t  crc;          // Data Checksum
+
+  //
+  // Mechanics section
+  //
+  eeprom_section_t  mechanics_section;
 
   //
   // Mechanics data
@@ -83,6 +108,11 @@ typedef struct EepromDataStruct {
   //
   SoundModeEnum     sound_mode;
 
+  //
+  // Heaters section
+  //
+  eeprom_section_t  heaters_section;
+
   //
   // Heaters data
   //
@@ -127,6 +157,11 @@ typedef struct EepromDataStruct {
     power_data_t    power_data;
   #endif
 
+  //
+  // Leveling section
+  //
+  eeprom_section_t  leveling_section;
+
   //
   // Z fade height
   //
@@ -177,6 +212,11 @@ typedef struct EepromDataStruct {
     probe_data_t    probe_data;
   #endif
 
+  //
+  // LCD section
+  //
+  eeprom_section_t  lcd_section;
+
   //
   // LCD menu
   //
@@ -196,17 +236,22 @@ typedef struct EepromDataStruct {
   #endif
 
   //
-  // PID add extrusion rate
+  // LCD contrast
   //
-  #if ENABLED(PID_ADD_EXTRUSION_RATE)
-    int16_t         lpq_len;
+  #if HAS_LCD_CONTRAST
+    uint8_t         lcdui_contrast;
   #endif
 
   //
-  // LCD contrast
+  // Features section
   //
-  #if HAS_LCD_CONTRAST
-    uint8_t         lcdui_contrast;
+  eeprom_section_t  features_section;
+
+  //
+  // PID add extrusion rate
+  //
+  #if ENABLED(PID_ADD_EXTRUSION_RATE)
+    int16_t         lpq_len;
   #endif
 
   //
@@ -272,6 +317,7 @@ typedef struct EepromDataStruct {
   //
   #if ENABLED(HYSTERESIS_FEATURE)
     float           hysteresis_mm[XYZ],
+                    hysteresis_smoothing_mm[XYZ],
                     hysteresis_correction;
   #endif
 
@@ -282,6 +328,11 @@ typedef struct EepromDataStruct {
     advanced_pause_data_t advanced_pause_data[EXTRUDERS];
   #endif
 
+  //
+  // TMC section
+  //
+  eeprom_section_t  tmc_section;
+
   //
   // Trinamic
   //
@@ -295,6 +346,14 @@ typedef struct EepromDataStruct {
 
 } eepromData;
 
+#define SECTION_SIZE(S,NEXT)  (offsetof(eepromData, NEXT) - offsetof(eepromData, S) - sizeof(eeprom_section_t))
+#define MECHANICS_SIZE        SECTION_SIZE(mechanics_section, heaters_section)
+#define HEATERS_SIZE          SECTION_SIZE(heaters_section, leveling_section)
+#define LEVELING_SIZE         SECTION_SIZE(leveling_section, lcd_section)
+#define LCD_SIZE              SECTION_SIZE(lcd_section, features_section)
+#define FEATURES_SIZE         SECTION_SIZE(features_section, tmc_section)
+#define TMC_SIZE              (sizeof(eepromData) - offsetof(eepromData, tmc_section) - sizeof(eeprom_section_t))
+
 EEPROM eeprom;
 
 uint16_t EEPROM::datasize() { return sizeof(eepromData); }
@@ -422,6 +481,9 @@ void EEPROM::post_process() {
       "Field " STRINGIFY(FIELD) " mismatch." \
     )
 
+  #define EEPROM_SECTION_BEGIN(S)       do{ _FIELD_TEST(S); section_index = eeprom_index; EEPROM_SKIP(eeprom_section_t); working_crc = 0; }while(0)
+  #define EEPROM_SECTION_END(VER,SIZE)  eeprom_error |= store_section(section_index, eeprom_index, VER, SIZE, working_crc)
+
   const char version[6] = EEPROM_VERSION;
 
   bool  EEPROM::eeprom_error  = false,
@@ -431,6 +493,67 @@ void EEPROM::post_process() {
     uint16_t EEPROM::meshes_begin = 0;
   #endif
 
+  /**
+   * Write the header of the section that begins at pos
+   */
+  bool EEPROM::store_section(int pos, const int end_index, const uint8_t ver, const uint16_t size, const uint16_t crc) {
+    eeprom_section_t section;
+    section.version   = ver;
+    section.reserved  = 0;
+    section.size      = end_index - pos - sizeof(eeprom_section_t);
+    section.crc       = crc;
+    section.pad       = 0;
+    if (section.size != size) {
+      #if ENABLED(EEPROM_CHITCHAT)
+        SERIAL_LM(ER, "EEPROM section size error.");
+      #endif
+      return true;
+    }
+    uint16_t header_crc = 0;
+    return memorystore.write_data(pos, (uint8_t*)&section, sizeof(section), &header_crc);
+  }
+
+  /**
+   * Check version, size and checksum of the section at eeprom_index.
+   * Return 'true' if it can be read, with eeprom_index on its data.
+   * next_index is set to the next section, or -1 if it can't be found.
+   */
+  bool EEPROM::load_section(int &eeprom_index, int &next_index, const uint8_t ver, const uint16_t size, PGM_P const name) {
+
+    eeprom_section_t section;
+    uint16_t working_crc = 0;
+    bool valid = false;
+
+    next_index = -1;
+
+    if (eeprom_index >= 0) {
+      EEPROM_READ_ALWAYS(section);
+      if (eeprom_index + section.size < int(memorystore.capacity()))
+        next_index = eeprom_index + section.size;
+      if (next_index >= 0 && section.version == ver && section.size == size) {
+        int data_index = eeprom_index;
+        working_crc = 0;
+        memorystore.read_data(data_index, (uint8_t*)&section, section.size, &working_crc, false);
+        valid = (working_crc == section.crc);
+      }
+    }
+
+    if (!valid) {
+      eeprom_error = true;
+      #if ENABLED(EEPROM_CHITCHAT)
+        if (validating) {
+          SERIAL_SM(ECHO, "EEPROM section ");
+          SERIAL_STR(name);
+          SERIAL_EM(" mismatch, using defaults");
+        }
+      #else
+        UNUSED(name);
+      #endif
+    }
+
+    return valid;
+  }
+
   bool EEPROM::size_error(const uint16_t size) {
     if (size != datasize()) {
       #if ENABLED(EEPROM_CHITCHAT)
@@ -451,7 +574,8 @@ void EEPROM::post_process() {
 
     uint16_t working_crc = 0;
 
-    int eeprom_index = EEPROM_OFFSET;
+    int eeprom_index = EEPROM_OFFSET,
+        section_index;
 
     eeprom_error = false;
 
@@ -460,9 +584,8 @@ void EEPROM::post_process() {
     #else
       EEPROM_WRITE(ver);      // invalidate data first
     #endif
-    EEPROM_SKIP(working_crc); // Skip the checksum slot
 
-    working_crc = 0; // clear before first "real data"
+    EEPROM_SECTION_BEGIN(mechanics_section);
 
     //
     // Mechanics data
@@ -489,6 +612,9 @@ void EEPROM::post_process() {
     //
     EEPROM_WRITE(sound.mode);
 
+    EEPROM_SECTION_END(EEPROM_MECHANICS_VERSION, MECHANICS_SIZE);
+    EEPROM_SECTION_BEGIN(heaters_section);
+
     //
     // Heaters data
     //
@@ -533,6 +659,9 @@ void EEPROM::post_process() {
       EEPROM_WRITE(powerManager.data);
     #endif
 
+    EEPROM_SECTION_END(EEPROM_HEATERS_VERSION, HEATERS_SIZE);
+    EEPROM_SECTION_BEGIN(leveling_section);
+
     //
     // Z fade height
     //
@@ -594,6 +723,9 @@ void EEPROM::post_process() {
       EEPROM_WRITE(probe.data);
     #endif
 
+    EEPROM_SECTION_END(EEPROM_LEVELING_VERSION, LEVELING_SIZE);
+    EEPROM_SECTION_BEGIN(lcd_section);
+
     //
     // LCD menu
     //
@@ -613,17 +745,20 @@ void EEPROM::post_process() {
     #endif
 
     //
-    // PID add extrusion rate
+    // LCD contrast
     //
-    #if ENABLED(PID_ADD_EXTRUSION_RATE)
-      EEPROM_WRITE(tools.lpq_len);
+    #if HAS_LCD_CONTRAST
+      EEPROM_WRITE(lcdui.contrast);
     #endif
 
+    EEPROM_SECTION_END(EEPROM_LCD_VERSION, LCD_SIZE);
+    EEPROM_SECTION_BEGIN(features_section);
+
     //
-    // LCD contrast
+    // PID add extrusion rate
     //
-    #if HAS_LCD_CONTRAST
-      EEPROM_WRITE(lcdui.contrast);
+    #if ENABLED(PID_ADD_EXTRUSION_RATE)
+      EEPROM_WRITE(tools.lpq_len);
     #endif
 
     //
@@ -695,6 +830,7 @@ void EEPROM::post_process() {
     //
     #if ENABLED(HYSTERESIS_FEATURE)
       EEPROM_WRITE(hysteresis.mm);
+      EEPROM_WRITE(hysteresis.smoothing_mm);
       EEPROM_WRITE(hysteresis.correction);
     #endif
 
@@ -705,6 +841,9 @@ void EEPROM::post_process() {
       EEPROM_WRITE(advancedpause.data);
     #endif
 
+    EEPROM_SECTION_END(EEPROM_FEATURES_VERSION, FEATURES_SIZE);
+    EEPROM_SECTION_BEGIN(tmc_section);
+
     //
     // Save TMC2130 or TMC2208 Configuration, and placeholder values
     //
@@ -759,24 +898,23 @@ void EEPROM::post_process() {
 
     #endif // HAS_TRINAMIC
 
+    EEPROM_SECTION_END(EEPROM_TMC_VERSION, TMC_SIZE);
+
     //
-    // Validate CRC and Data Size
+    // Validate Data Size
     //
     if (!eeprom_error) {
-      const uint16_t  eeprom_size = eeprom_index - (EEPROM_OFFSET),
-                      final_crc = working_crc;
+      const uint16_t eeprom_size = eeprom_index - (EEPROM_OFFSET);
 
       // Write the EEPROM header
       eeprom_index = EEPROM_OFFSET;
 
       EEPROM_WRITE(version);
-      EEPROM_WRITE(final_crc);
 
       // Report storage size
       #if ENABLED(EEPROM_CHITCHAT)
         SERIAL_SMV(ECHO, "Settings Stored (", eeprom_size);
-        SERIAL_MV(" bytes; crc ", final_crc);
-        SERIAL_EM(")");
+        SERIAL_EM(" bytes)");
       #endif
 
       eeprom_error |= size_error(eeprom_size);
@@ -802,15 +940,16 @@ void EEPROM::post_process() {
    */
   bool EEPROM::_load() {
 
-    uint16_t  working_crc = 0,
-              stored_crc  = 0;
+    uint16_t working_crc = 0;
 
     char stored_ver[6];
 
-    int eeprom_index = EEPROM_OFFSET;
+    int eeprom_index = EEPROM_OFFSET,
+        next_index;
+
+    eeprom_error = false;
 
     EEPROM_READ_ALWAYS(stored_ver);
-    EEPROM_READ_ALWAYS(stored_crc);
 
     if (strncmp(version, stored_ver, 5) != 0) {
       if (stored_ver[0] != 'M') {
@@ -819,373 +958,390 @@ void EEPROM::post_process() {
         stored_ver[2] = '\0';
       }
       #if ENABLED(EEPROM_CHITCHAT)
-        SERIAL_SM(ECHO, "EEPROM version mismatch ");
-        SERIAL_MT("(EEPROM=", stored_ver);
-        SERIAL_EM(" MK4duo=" EEPROM_VERSION ")");
+        if (validating) {
+          SERIAL_SM(ECHO, "EEPROM version mismatch ");
+          SERIAL_MT("(EEPROM=", stored_ver);
+          SERIAL_EM(" MK4duo=" EEPROM_VERSION ")");
+        }
       #endif
-      reset();
       eeprom_error = true;
     }
     else {
 
       float dummy = 0;
 
-      working_crc = 0; // Init to 0. Accumulated by EEPROM_READ
+      // Only the valid sections are read, the others keep the defaults set by load()
 
-      //
-      // Mechanics data
-      //
-      EEPROM_READ(mechanics.data);
+      if (load_section(eeprom_index, next_index, EEPROM_MECHANICS_VERSION, MECHANICS_SIZE, PSTR("Mechanics"))) {
 
-      //
-      // Endstops data
-      //
-      EEPROM_READ(endstops.data);
+        //
+        // Mechanics data
+        //
+        EEPROM_READ(mechanics.data);
 
-      //
-      // Stepper data
-      //
-      EEPROM_READ(stepper.data);
+        //
+        // Endstops data
+        //
+        EEPROM_READ(endstops.data);
 
-      //
-      // Hotend offset
-      //
-      EEPROM_READ(tools.data);
+        //
+        // Stepper data
+        //
+        EEPROM_READ(stepper.data);
 
-      //
-      // Sound
-      //
-      EEPROM_READ(sound.mode);
+        //
+        // Hotend offset
+        //
+        EEPROM_READ(tools.data);
 
-      //
-      // Heaters data
-      //
-      #if HOTENDS > 0
-        LOOP_HOTEND() EEPROM_READ(hotends[h].data);
-      #endif
-      #if BEDS > 0
-        LOOP_BED() EEPROM_READ(beds[h].data);
-      #endif
-      #if CHAMBERS > 0
-        LOOP_CHAMBER() EEPROM_READ(chambers[h].data);
-      #endif
-      #if COOLERS > 0
-        LOOP_COOLER() EEPROM_READ(coolers[h].data);
-      #endif
+        //
+        // Sound
+        //
+        EEPROM_READ(sound.mode);
 
-      //
-      // DHT sensor data
-      //
-      #if ENABLED(DHT_SENSOR)
-        EEPROM_READ(dhtsensor.data);
-      #endif
+      }
+      eeprom_index = next_index;
 
-      //
-      // Fans data
-      //
-      #if FAN_COUNT > 0
-        LOOP_FAN() EEPROM_READ(fans[f].data);
-      #endif
+      if (load_section(eeprom_index, next_index, EEPROM_HEATERS_VERSION, HEATERS_SIZE, PSTR("Heaters"))) {
 
-      //
-      // Filament Runout data
-      //
-      #if HAS_FILAMENT_SENSOR
-        EEPROM_READ(filamentrunout.sensor.data);
-      #endif
+        //
+        // Heaters data
+        //
+        #if HOTENDS > 0
+          LOOP_HOTEND() EEPROM_READ(hotends[h].data);
+        #endif
+        #if BEDS > 0
+          LOOP_BED() EEPROM_READ(beds[h].data);
+        #endif
+        #if CHAMBERS > 0
+          LOOP_CHAMBER() EEPROM_READ(chambers[h].data);
+        #endif
+        #if COOLERS > 0
+          LOOP_COOLER() EEPROM_READ(coolers[h].data);
+        #endif
 
-      //
-      // PowerManager data
-      //
-      #if HAS_POWER_CHECK
-        EEPROM_READ(powerManager.data);
-      #endif
+        //
+        // DHT sensor data
+        //
+        #if ENABLED(DHT_SENSOR)
+          EEPROM_READ(dhtsensor.data);
+        #endif
 
-      //
-      // Z fade height
-      //
-      #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
-        EEPROM_READ(new_z_fade_height);
-      #endif
+        //
+        // Fans data
+        //
+        #if FAN_COUNT > 0
+          LOOP_FAN() EEPROM_READ(fans[f].data);
+        #endif
 
-      //
-      // Mesh Bed Leveling
-      //
-      #if ENABLED(MESH_BED_LEVELING)
-        uint8_t mesh_num_x = 0, mesh_num_y = 0;
-        mbl.reset();
-        EEPROM_READ(mbl.z_offset);
-        EEPROM_READ_ALWAYS(mesh_num_x);
-        EEPROM_READ_ALWAYS(mesh_num_y);
-        if (mesh_num_x == GRID_MAX_POINTS_X && mesh_num_y == GRID_MAX_POINTS_Y) {
-          // EEPROM data fits the current mesh
-          EEPROM_READ(mbl.z_values);
-        }
-        else {
-          // EEPROM data is stale
-          for (uint8_t q = 0; q < mesh_num_x * mesh_num_y; q++) EEPROM_READ(dummy);
-        }
-      #endif // MESH_BED_LEVELING
+        //
+        // Filament Runout data
+        //
+        #if HAS_FILAMENT_SENSOR
+          EEPROM_READ(filamentrunout.sensor.data);
+        #endif
 
-      //
-      // Planar Bed Leveling matrix
-      //
-      #if ABL_PLANAR
-        EEPROM_READ(bedlevel.matrix);
-      #endif
+        //
+        // PowerManager data
+        //
+        #if HAS_POWER_CHECK
+          EEPROM_READ(powerManager.data);
+        #endif
 
-      //
-      // Bilinear Auto Bed Leveling
-      //
-      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-        uint8_t grid_max_x, grid_max_y;
-        EEPROM_READ_ALWAYS(grid_max_x);            // 1 byte
-        EEPROM_READ_ALWAYS(grid_max_y);            // 1 byte
-        if (grid_max_x == GRID_MAX_POINTS_X && grid_max_y == GRID_MAX_POINTS_Y) {
-          if (!validating) bedlevel.set_bed_leveling_enabled(false);
-          EEPROM_READ(abl.bilinear_grid_spacing); // 2 ints
-          EEPROM_READ(abl.bilinear_start);        // 2 ints
-          EEPROM_READ(abl.z_values);              // 9 to 256 floats
-        }
-        else { // EEPROM data is stale
-          // Skip past disabled (or stale) Bilinear Grid data
-          int bgs[2], bs[2];
-          EEPROM_READ(bgs);
-          EEPROM_READ(bs);
-          for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummy);
-        }
-      #endif // AUTO_BED_LEVELING_BILINEAR
+      }
+      eeprom_index = next_index;
 
-      //
-      // Universal Bed Leveling
-      //
-      #if ENABLED(AUTO_BED_LEVELING_UBL)
-        bool bedlevel_leveling_active;
-        EEPROM_READ(bedlevel_leveling_active);
-        EEPROM_READ(ubl.storage_slot);
-        bedlevel.flag.leveling_active = bedlevel_leveling_active;
-      #endif
+      if (load_section(eeprom_index, next_index, EEPROM_LEVELING_VERSION, LEVELING_SIZE, PSTR("Leveling"))) {
 
-      //
-      // Probe data
-      //
-      #if HAS_BED_PROBE
-        EEPROM_READ(probe.data);
-      #endif
+        //
+        // Z fade height
+        //
+        #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
+          EEPROM_READ(new_z_fade_height);
+        #endif
 
-      //
-      // LCD menu
-      //
-      #if HAS_LCD_MENU
-        #if HOTENDS > 0
-          EEPROM_READ(lcdui.preheat_hotend_temp);
+        //
+        // Mesh Bed Leveling
+        //
+        #if ENABLED(MESH_BED_LEVELING)
+          uint8_t mesh_num_x = 0, mesh_num_y = 0;
+          mbl.reset();
+          EEPROM_READ(mbl.z_offset);
+          EEPROM_READ_ALWAYS(mesh_num_x);
+          EEPROM_READ_ALWAYS(mesh_num_y);
+          if (mesh_num_x == GRID_MAX_POINTS_X && mesh_num_y == GRID_MAX_POINTS_Y) {
+            // EEPROM data fits the current mesh
+            EEPROM_READ(mbl.z_values);
+          }
+          else {
+            // EEPROM data is stale
+            for (uint8_t q = 0; q < mesh_num_x * mesh_num_y; q++) EEPROM_READ(dummy);
+          }
+        #endif // MESH_BED_LEVELING
+
+        //
+        // Planar Bed Leveling matrix
+        //
+        #if ABL_PLANAR
+          EEPROM_READ(bedlevel.matrix);
         #endif
-        #if BEDS > 0
-          EEPROM_READ(lcdui.preheat_bed_temp);
+
+        //
+        // Bilinear Auto Bed Leveling
+        //
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          uint8_t grid_max_x, grid_max_y;
+          EEPROM_READ_ALWAYS(grid_max_x);            // 1 byte
+          EEPROM_READ_ALWAYS(grid_max_y);            // 1 byte
+          if (grid_max_x == GRID_MAX_POINTS_X && grid_max_y == GRID_MAX_POINTS_Y) {
+            if (!validating) bedlevel.set_bed_leveling_enabled(false);
+            EEPROM_READ(abl.bilinear_grid_spacing); // 2 ints
+            EEPROM_READ(abl.bilinear_start);        // 2 ints
+            EEPROM_READ(abl.z_values);              // 9 to 256 floats
+          }
+          else { // EEPROM data is stale
+            // Skip past disabled (or stale) Bilinear Grid data
+            int bgs[2], bs[2];
+            EEPROM_READ(bgs);
+            EEPROM_READ(bs);
+            for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummy);
+          }
+        #endif // AUTO_BED_LEVELING_BILINEAR
+
+        //
+        // Universal Bed Leveling
+        //
+        #if ENABLED(AUTO_BED_LEVELING_UBL)
+          bool bedlevel_leveling_active;
+          EEPROM_READ(bedlevel_leveling_active);
+          EEPROM_READ(ubl.storage_slot);
+          bedlevel.flag.leveling_active = bedlevel_leveling_active;
         #endif
-        #if CHAMBERS > 0
-          EEPROM_READ(lcdui.preheat_chamber_temp);
+
+        //
+        // Probe data
+        //
+        #if HAS_BED_PROBE
+          EEPROM_READ(probe.data);
         #endif
-        #if FAN_COUNT > 0
-          EEPROM_READ(lcdui.preheat_fan_speed);
+
+      }
+      eeprom_index = next_index;
+
+      if (load_section(eeprom_index, next_index, EEPROM_LCD_VERSION, LCD_SIZE, PSTR("LCD"))) {
+
+        //
+        // LCD menu
+        //
+        #if HAS_LCD_MENU
+          #if HOTENDS > 0
+            EEPROM_READ(lcdui.preheat_hotend_temp);
+          #endif
+          #if BEDS > 0
+            EEPROM_READ(lcdui.preheat_bed_temp);
+          #endif
+          #if CHAMBERS > 0
+            EEPROM_READ(lcdui.preheat_chamber_temp);
+          #endif
+          #if FAN_COUNT > 0
+            EEPROM_READ(lcdui.preheat_fan_speed);
+          #endif
         #endif
-      #endif
 
-      //
-      // PID add extrusion rate
-      //
-      #if ENABLED(PID_ADD_EXTRUSION_RATE)
-        EEPROM_READ(tools.lpq_len);
-      #endif
+        //
+        // LCD contrast
+        //
+        #if HAS_LCD_CONTRAST
+          EEPROM_READ(lcdui.contrast);
+        #endif
 
-      //
-      // LCD contrast
-      //
-      #if HAS_LCD_CONTRAST
-        EEPROM_READ(lcdui.contrast);
-      #endif
+      }
+      eeprom_index = next_index;
 
-      //
-      // SD Restart
-      //
-      #if HAS_SD_RESTART
-        EEPROM_READ(restart.enabled);
-      #endif
+      if (load_section(eeprom_index, next_index, EEPROM_FEATURES_VERSION, FEATURES_SIZE, PSTR("Features"))) {
 
-      //
-      // Servo angles
-      //
-      #if HAS_SERVOS
-        LOOP_SERVO() EEPROM_READ(servo[s].angle);
-      #endif
+        //
+        // PID add extrusion rate
+        //
+        #if ENABLED(PID_ADD_EXTRUSION_RATE)
+          EEPROM_READ(tools.lpq_len);
+        #endif
 
-      //
-      // BLTOUCH
-      //
-      #if ENABLED(BLTOUCH)
-        EEPROM_READ(bltouch.last_mode);
-      #endif
+        //
+        // SD Restart
+        //
+        #if HAS_SD_RESTART
+          EEPROM_READ(restart.enabled);
+        #endif
 
-      //
-      // Firmware Retraction
-      //
-      #if ENABLED(FWRETRACT)
-        EEPROM_READ(fwretract.data);
-        EEPROM_READ(fwretract.autoretract_enabled);
-      #endif
+        //
+        // Servo angles
+        //
+        #if HAS_SERVOS
+          LOOP_SERVO() EEPROM_READ(servo[s].angle);
+        #endif
 
-      //
-      // Volumetric & Filament Size
-      //
-      #if ENABLED(VOLUMETRIC_EXTRUSION)
+        //
+        // BLTOUCH
+        //
+        #if ENABLED(BLTOUCH)
+          EEPROM_READ(bltouch.last_mode);
+        #endif
 
-        bool volumetric_enabled;
-        EEPROM_READ(volumetric_enabled);
-        if (!validating) printer.setVolumetric(volumetric_enabled);
+        //
+        // Firmware Retraction
+        //
+        #if ENABLED(FWRETRACT)
+          EEPROM_READ(fwretract.data);
+          EEPROM_READ(fwretract.autoretract_enabled);
+        #endif
 
-        LOOP_EXTRUDER()
-          EEPROM_READ(tools.filament_size[e]);
+        //
+        // Volumetric & Filament Size
+        //
+        #if ENABLED(VOLUMETRIC_EXTRUSION)
 
-      #endif
+          bool volumetric_enabled;
+          EEPROM_READ(volumetric_enabled);
+          if (!validating) printer.setVolumetric(volumetric_enabled);
 
-      //
-      // IDLE oozing
-      //
-      #if ENABLED(IDLE_OOZING_PREVENT)
-        EEPROM_READ(printer.IDLE_OOZING_enabled);
-      #endif
+          LOOP_EXTRUDER()
+            EEPROM_READ(tools.filament_size[e]);
 
-      //
-      // Alligator board
-      //
-      #if MB(ALLIGATOR_R2) || MB(ALLIGATOR_R3)
-        EEPROM_READ(externaldac.motor_current);
-      #endif
+        #endif
 
-      //
-      // Linear Advance
-      //
-      #if ENABLED(LIN_ADVANCE)
-        EEPROM_READ(planner.extruder_advance_K);
-      #endif
+        //
+        // IDLE oozing
+        //
+        #if ENABLED(IDLE_OOZING_PREVENT)
+          EEPROM_READ(printer.IDLE_OOZING_enabled);
+        #endif
 
-      //
-      // Hysteresis Feature
-      //
-      #if ENABLED(HYSTERESIS_FEATURE)
-        EEPROM_READ(hysteresis.mm);
-        EEPROM_READ(hysteresis.correction);
-      #endif
+        //
+        // Alligator board
+        //
+        #if MB(ALLIGATOR_R2) || MB(ALLIGATOR_R3)
+          EEPROM_READ(externaldac.motor_current);
+        #endif
 
-      //
-      // Advanced Pause data
-      //
-      #if ENABLED(ADVANCED_PAUSE_FEATURE)
-        EEPROM_READ(advancedpause.data);
-      #endif
+        //
+        // Linear Advance
+        //
+        #if ENABLED(LIN_ADVANCE)
+          EEPROM_READ(planner.extruder_advance_K);
+        #endif
+
+        //
+        // Hysteresis Feature
+        //
+        #if ENABLED(HYSTERESIS_FEATURE)
+          EEPROM_READ(hysteresis.mm);
+          EEPROM_READ(hysteresis.smoothing_mm);
+          EEPROM_READ(hysteresis.correction);
+        #endif
+
+        //
+        // Advanced Pause data
+        //
+        #if ENABLED(ADVANCED_PAUSE_FEATURE)
+          EEPROM_READ(advancedpause.data);
+        #endif
+
+      }
+      eeprom_index = next_index;
 
       if (!validating) reset_stepper_drivers();
 
-      //
-      // TMC2130 or TMC2208 Stepper Current
-      //
-      #if HAS_TRINAMIC
+      if (load_section(eeprom_index, next_index, EEPROM_TMC_VERSION, TMC_SIZE, PSTR("TMC"))) {
 
-        uint16_t  tmc_stepper_current[TMC_AXIS],
-                  tmc_stepper_microstep[TMC_AXIS];
-        uint32_t  tmc_hybrid_threshold[TMC_AXIS];
-        bool      tmc_stealth_enabled[TMC_AXIS];
+        //
+        // TMC2130 or TMC2208 Stepper Current
+        //
+        #if HAS_TRINAMIC
 
-        EEPROM_READ(tmc_stepper_current);
-        EEPROM_READ(tmc_stepper_microstep);
-        EEPROM_READ(tmc_hybrid_threshold);
-        EEPROM_READ(tmc_stealth_enabled);
+          uint16_t  tmc_stepper_current[TMC_AXIS],
+                    tmc_stepper_microstep[TMC_AXIS];
+          uint32_t  tmc_hybrid_threshold[TMC_AXIS];
+          bool      tmc_stealth_enabled[TMC_AXIS];
 
-        if (!validating) {
-          LOOP_TMC() {
-            MKTMC* st = tmc.driver_by_index(t);
-            if (st) {
-              st->rms_current(tmc_stepper_current[t]);
-              st->microsteps(tmc_stepper_microstep[t]);
-              #if ENABLED(HYBRID_THRESHOLD)
-                st->set_pwm_thrs(tmc_hybrid_threshold[t]);
-              #endif
-              #if TMC_HAS_STEALTHCHOP
-                st->stealthChop_enabled = tmc_stealth_enabled[t];
-                st->refresh_stepping_mode();
-              #endif
+          EEPROM_READ(tmc_stepper_current);
+          EEPROM_READ(tmc_stepper_microstep);
+          EEPROM_READ(tmc_hybrid_threshold);
+          EEPROM_READ(tmc_stealth_enabled);
+
+          if (!validating) {
+            LOOP_TMC() {
+              MKTMC* st = tmc.driver_by_index(t);
+              if (st) {
+                st->rms_current(tmc_stepper_current[t]);
+                st->microsteps(tmc_stepper_microstep[t]);
+                #if ENABLED(HYBRID_THRESHOLD)
+                  st->set_pwm_thrs(tmc_hybrid_threshold[t]);
+                #endif
+                #if TMC_HAS_STEALTHCHOP
+                  st->stealthChop_enabled = tmc_stealth_enabled[t];
+                  st->refresh_stepping_mode();
+                #endif
+              }
             }
           }
-        }
 
-        /*
-         * TMC2130 Sensorless homing threshold.
-         * X and X2 use the same value
-         * Y and Y2 use the same value
-         * Z, Z2 and Z3 use the same value
-         */
-        int16_t tmc_sgt[XYZ];
-        EEPROM_READ(tmc_sgt);
-        #if HAS_SENSORLESS
-          if (!validating) {
-            #if ENABLED(X_STALL_SENSITIVITY)
-              #if AXIS_HAS_STALLGUARD(X)
-                stepperX->sgt(tmc_sgt[X_AXIS]);
-              #endif
-              #if AXIS_HAS_STALLGUARD(X2)
-                stepperX2->sgt(tmc_sgt[X_AXIS]);
+          /*
+           * TMC2130 Sensorless homing threshold.
+           * X and X2 use the same value
+           * Y and Y2 use the same value
+           * Z, Z2 and Z3 use the same value
+           */
+          int16_t tmc_sgt[XYZ];
+          EEPROM_READ(tmc_sgt);
+          #if HAS_SENSORLESS
+            if (!validating) {
+              #if ENABLED(X_STALL_SENSITIVITY)
+                #if AXIS_HAS_STALLGUARD(X)
+                  stepperX->sgt(tmc_sgt[X_AXIS]);
+                #endif
+                #if AXIS_HAS_STALLGUARD(X2)
+                  stepperX2->sgt(tmc_sgt[X_AXIS]);
+                #endif
               #endif
-            #endif
-            #if ENABLED(Y_STALL_SENSITIVITY)
-              #if AXIS_HAS_STALLGUARD(Y)
-                stepperY->sgt(tmc_sgt[Y_AXIS]);
-              #endif
-              #if AXIS_HAS_STALLGUARD(Y2)
-                stepperY2->sgt(tmc_sgt[Y_AXIS]);
-              #endif
-            #endif
-            #if ENABLED(Z_STALL_SENSITIVITY)
-              #if AXIS_HAS_STALLGUARD(Z)
-                stepperZ->sgt(tmc_sgt[Z_AXIS]);
-              #endif
-              #if AXIS_HAS_STALLGUARD(Z2)
-                stepperZ2->sgt(tmc_sgt[Z_AXIS]);
+              #if ENABLED(Y_STALL_SENSITIVITY)
+                #if AXIS_HAS_STALLGUARD(Y)
+                  stepperY->sgt(tmc_sgt[Y_AXIS]);
+                #endif
+                #if AXIS_HAS_STALLGUARD(Y2)
+                  stepperY2->sgt(tmc_sgt[Y_AXIS]);
+                #endif
               #endif
-              #if AXIS_HAS_STALLGUARD(Z3)
-                stepperZ3->sgt(tmc_sgt[Z_AXIS]);
+              #if ENABLED(Z_STALL_SENSITIVITY)
+                #if AXIS_HAS_STALLGUARD(Z)
+                  stepperZ->sgt(tmc_sgt[Z_AXIS]);
+                #endif
+                #if AXIS_HAS_STALLGUARD(Z2)
+                  stepperZ2->sgt(tmc_sgt[Z_AXIS]);
+                #endif
+                #if AXIS_HAS_STALLGUARD(Z3)
+                  stepperZ3->sgt(tmc_sgt[Z_AXIS]);
+                #endif
               #endif
-            #endif
-          }
-        #endif
+            }
+          #endif
 
-      #endif // HAS_TRINAMIC
+        #endif // HAS_TRINAMIC
 
-      eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
-      if (eeprom_error) {
-        #if ENABLED(EEPROM_CHITCHAT)
-          SERIAL_MV("Index: ", int(eeprom_index - (EEPROM_OFFSET)));
-          SERIAL_MV(" Size: ", datasize());
-          SERIAL_EOL();
-        #endif
-      }
-      else if (working_crc != stored_crc) {
-        eeprom_error = true;
-        #if ENABLED(EEPROM_CHITCHAT)
-          SERIAL_SMV(ER, "EEPROM CRC mismatch - (stored) ", stored_crc);
-          SERIAL_MV(" != ", working_crc);
-          SERIAL_EM(" (calculated)!");
-        #endif
       }
-      else if (!validating) {
-        #if ENABLED(EEPROM_CHITCHAT)
+
+      // Skipped sections don't move the end of the data
+      eeprom_index = EEPROM_OFFSET + datasize();
+
+      #if ENABLED(EEPROM_CHITCHAT)
+        if (!validating && !eeprom_error) {
           SERIAL_ST(ECHO, version);
-          SERIAL_MV(" Stored settings retrieved (", eeprom_index - (EEPROM_OFFSET));
-          SERIAL_MV(" bytes; crc ", (uint32_t)working_crc);
-          SERIAL_EM(")");
-        #endif
-      }
+          SERIAL_MV(" Stored settings retrieved (", datasize());
+          SERIAL_EM(" bytes)");
+        }
+      #endif
 
-      if (!validating && !eeprom_error) post_process();
+      if (!validating) post_process();
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
 
@@ -1247,7 +1403,9 @@ void EEPROM::post_process() {
 
   bool EEPROM::load() {
     if (validate()) return _load();
+    // Start from the defaults and keep the sections that are still valid
     reset();
+    (void)_load();
     #if ENABLED(EEPROM_AUTO_INIT)
       (void)store();
       SERIAL_EM("EEPROM Initialized");
@@ -1267,14 +1425,91 @@ void EEPROM::post_process() {
 
     const uint16_t EEPROM::meshes_end = memorystore.capacity() - 129;
 
+    #if ENABLED(UBL_COMPACT_MESH)
+      #define MESH_SLOT_SIZE sizeof(mesh_record_t)
+    #else
+      #define MESH_SLOT_SIZE sizeof(ubl.z_values)
+    #endif
+
+    #if UBL_MESH_SD_SLOTS > 0
+      #define MESH_EEPROM_SLOTS ((meshes_end - meshes_start_index()) / MESH_SLOT_SIZE)
+    #endif
+
     uint16_t EEPROM::calc_num_meshes() {
-      return (meshes_end - meshes_start_index()) / sizeof(ubl.z_values);
+      return (meshes_end - meshes_start_index()) / MESH_SLOT_SIZE
+        #if UBL_MESH_SD_SLOTS > 0
+          + (UBL_MESH_SD_SLOTS)
+        #endif
+      ;
     }
 
     int EEPROM::mesh_slot_offset(const int8_t slot) {
-      return meshes_end - (slot + 1) * sizeof(ubl.z_values);
+      return meshes_end - (slot + 1) * MESH_SLOT_SIZE;
     }
 
+    #if ENABLED(UBL_COMPACT_MESH)
+
+      /**
+       * Pack the mesh as microns from its best-fit plane.
+       * Return 'true' if a point is more than 32mm from the plane.
+       */
+      bool EEPROM::pack_mesh(mesh_record_t &rec) {
+
+        memset(&rec, 0, sizeof(rec));
+
+        struct linear_fit_data lsf;
+        incremental_LSF_reset(&lsf);
+        for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++)
+          for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++)
+            if (!isnan(ubl.z_values[x][y]))
+              incremental_LSF(&lsf, x, y, ubl.z_values[x][y]);
+
+        if (finish_incremental_LSF(&lsf))
+          rec.plane[0] = lsf.zbar;  // Too few points for a plane, use the mean
+        else {
+          rec.plane[0] = -lsf.D;
+          rec.plane[1] = -lsf.A;
+          rec.plane[2] = -lsf.B;
+        }
+
+        for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++) {
+          for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++) {
+            if (isnan(ubl.z_values[x][y])) continue;
+            const float um = (ubl.z_values[x][y] - (rec.plane[0] + rec.plane[1] * x + rec.plane[2] * y)) * 1000.0f;
+            if (!WITHIN(um, -32767, 32767)) return true;
+            rec.z[x][y] = LROUND(um);
+            const uint16_t i = x * (GRID_MAX_POINTS_Y) + y;
+            SBI(rec.valid[i >> 3], i & 0x07);
+          }
+        }
+
+        crc16(&rec.crc, &rec, offsetof(mesh_record_t, crc));
+        return false;
+      }
+
+      /**
+       * Unpack a stored mesh. Return 'true' on CRC mismatch.
+       */
+      bool EEPROM::unpack_mesh(const mesh_record_t &rec, float (*dest)[GRID_MAX_POINTS_Y]) {
+
+        uint16_t crc = 0;
+        crc16(&crc, &rec, offsetof(mesh_record_t, crc));
+        if (crc != rec.crc) return true;
+
+        for (uint8_t x = 0; x < GRID_MAX_POINTS_X; x++) {
+          for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; y++) {
+            const uint16_t i = x * (GRID_MAX_POINTS_Y) + y;
+            dest[x][y] = TEST(rec.valid[i >> 3], i & 0x07)
+              ? rec.plane[0] + rec.plane[1] * x + rec.plane[2] * y + rec.z[x][y] * 0.001f
+              : NAN;
+          }
+        }
+
+        return false;
+      }
+
+    #endif // UBL_COMPACT_MESH
+
     void EEPROM::store_mesh(const int8_t slot) {
 
       const int16_t a = calc_num_meshes();
@@ -1288,10 +1523,34 @@ void EEPROM::post_process() {
         return;
       }
 
-      uint16_t crc = 0;
-      int pos = mesh_slot_offset(slot);
+      #if ENABLED(UBL_COMPACT_MESH)
+
+        mesh_record_t rec;
+        if (pack_mesh(rec)) {
+          SERIAL_MSG("?Mesh too far from its plane for a compact slot.\n");
+          return;
+        }
+
+        bool status;
+        #if UBL_MESH_SD_SLOTS > 0
+          if (slot >= int16_t(MESH_EEPROM_SLOTS))
+            status = card.write_mesh_file(slot - MESH_EEPROM_SLOTS, &rec, sizeof(rec));
+          else
+        #endif
+        {
+          uint16_t crc = 0;
+          int pos = mesh_slot_offset(slot);
+          status = memorystore.write_data(pos, (uint8_t *)&rec, sizeof(rec), &crc);
+        }
+
+      #else
+
+        uint16_t crc = 0;
+        int pos = mesh_slot_offset(slot);
 
-      const bool status = memorystore.write_data(pos, (uint8_t *)&ubl.z_values, sizeof(ubl.z_values), &crc);
+        const bool status = memorystore.write_data(pos, (uint8_t *)&ubl.z_values, sizeof(ubl.z_values), &crc);
+
+      #endif
 
       if (status)
         SERIAL_MSG("?Unable to save mesh data.\n");
@@ -1314,11 +1573,33 @@ void EEPROM::post_process() {
         return;
       }
 
-      int pos = mesh_slot_offset(slot);
-      uint16_t crc = 0;
-      uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&ubl.z_values;
+      #if ENABLED(UBL_COMPACT_MESH)
+
+        mesh_record_t rec;
+        bool status;
+        #if UBL_MESH_SD_SLOTS > 0
+          if (slot >= int16_t(MESH_EEPROM_SLOTS))
+            status = card.read_mesh_file(slot - MESH_EEPROM_SLOTS, &rec, sizeof(rec));
+          else
+        #endif
+        {
+          uint16_t crc = 0;
+          int pos = mesh_slot_offset(slot);
+          status = memorystore.read_data(pos, (uint8_t *)&rec, sizeof(rec), &crc);
+        }
+
+        // The destination is left untouched if the slot is not valid
+        if (!status) status = unpack_mesh(rec, into ? (float (*)[GRID_MAX_POINTS_Y])into : ubl.z_values);
+
+      #else
 
-      const bool status = memorystore.read_data(pos, dest, sizeof(ubl.z_values), &crc);
+        int pos = mesh_slot_offset(slot);
+        uint16_t crc = 0;
+        uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&ubl.z_values;
+
+        const bool status = memorystore.read_data(pos, dest, sizeof(ubl.z_values), &crc);
+
+      #endif
 
       if (status)
         SERIAL_MSG("?Unable to load mesh data.\n");
@@ -1501,6 +1782,9 @@ void EEPROM::reset() {
         sens->shC             = 0;
         sens->adcLowOffset    = 0;
         sens->adcHighOffset   = 0;
+        #if ENABLED(SENSOR_CALIBRATION)
+          sens->reset_cal();
+        #endif
         #if HAS_AD8495 || HAS_AD595
           sens->ad595_offset  = TEMP_SENSOR_AD595_OFFSET;
           sens->ad595_gain    = TEMP_SENSOR_AD595_GAIN;
@@ -1554,6 +1838,9 @@ void EEPROM::reset() {
         sens->shC             = 0;
         sens->adcLowOffset    = 0;
         sens->adcHighOffset   = 0;
+        #if ENABLED(SENSOR_CALIBRATION)
+          sens->reset_cal();
+        #endif
         #if HAS_AD8495 || HAS_AD595
           sens->ad595_offset  = TEMP_SENSOR_AD595_OFFSET;
           sens->ad595_gain    = TEMP_SENSOR_AD595_GAIN;
@@ -1606,6 +1893,9 @@ void EEPROM::reset() {
         sens->shC             = 0;
         sens->adcLowOffset    = 0;
         sens->adcHighOffset   = 0;
+        #if ENABLED(SENSOR_CALIBRATION)
+          sens->reset_cal();
+        #endif
         #if HAS_AD8495 || HAS_AD595
           sens->ad595_offset  = TEMP_SENSOR_AD595_OFFSET;
           sens->ad595_gain    = TEMP_SENSOR_AD595_GAIN;
@@ -1650,6 +1940,9 @@ void EEPROM::reset() {
       sens->shC             = 0;
       sens->adcLowOffset    = 0;
       sens->adcHighOffset   = 0;
+      #if ENABLED(SENSOR_CALIBRATION)
+        sens->reset_cal();
+      #endif
       #if HAS_AD8495 || HAS_AD595
         sens->ad595_offset  = TEMP_SENSOR_AD595_OFFSET;
         sens->ad595_gain    = TEMP_SENSOR_AD595_GAIN;
@@ -1824,6 +2117,9 @@ void EEPROM::reset() {
       LOOP_HOTEND() {
         hotends[h].print_M305();
         hotends[h].print_M306();
+        #if ENABLED(SENSOR_CALIBRATION)
+          hotends[h].print_M309();
+        #endif
         hotends[h].print_M301();
       }
     #endif
@@ -1831,6 +2127,9 @@ void EEPROM::reset() {
       LOOP_BED() {
         beds[h].print_M305();
         beds[h].print_M306();
+        #if ENABLED(SENSOR_CALIBRATION)
+          beds[h].print_M309();
+        #endif
         beds[h].print_M301();
       }
     #endif
@@ -1838,6 +2137,9 @@ void EEPROM::reset() {
       LOOP_CHAMBER() {
         chambers[h].print_M305();
         chambers[h].print_M306();
+        #if ENABLED(SENSOR_CALIBRATION)
+          chambers[h].print_M309();
+        #endif
         chambers[h].print_M301();
       }
     #endif
@@ -1845,6 +2147,9 @@ void EEPROM::reset() {
       LOOP_COOLER() {
         coolers[h].print_M305();
         coolers[h].print_M306();
+        #if ENABLED(SENSOR_CALIBRATION)
+          coolers[h].print_M309();
+        #endif
         coolers[h].print_M301();
       }
     #endif
@@ -21,6 +21,16 @@
  */
 #pragma once
 
+#if ENABLED(AUTO_BED_LEVELING_UBL) && ENABLED(UBL_COMPACT_MESH)
+  // Compact mesh slot: Z in microns from the best-fit plane of the mesh
+  typedef struct {
+    float     plane[3];   // z = plane[0] + plane[1] * x_index + plane[2] * y_index
+    uint8_t   valid[(GRID_MAX_POINTS + 7) / 8];
+    int16_t   z[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+    uint16_t  crc;
+  } mesh_record_t;
+#endif
+
 class EEPROM {
 
   public: /** Constructor */
@@ -97,9 +107,16 @@ class EEPROM {
 
     static void post_process();
 
+    #if HAS_EEPROM && ENABLED(AUTO_BED_LEVELING_UBL) && ENABLED(UBL_COMPACT_MESH)
+      static bool pack_mesh(mesh_record_t &rec);
+      static bool unpack_mesh(const mesh_record_t &rec, float (*dest)[GRID_MAX_POINTS_Y]);
+    #endif
+
     #if HAS_EEPROM
       static bool _load();
       static bool size_error(const uint16_t size);
+      static bool store_section(int pos, const int end_index, const uint8_t ver, const uint16_t size, const uint16_t crc);
+      static bool load_section(int &eeprom_index, int &next_index, const uint8_t ver, const uint16_t size, PGM_P const name);
     #endif
 
 };
@@ -56,10 +56,21 @@ void Heater::init() {
 
   thermal_runaway_state = TRInactive;
 
+  #if ENABLED(CONCURRENT_PREHEAT)
+    heat_rate             = 0.0;
+    heat_rate_ms          = millis();
+    heat_rate_temp        = current_temperature;
+    heat_rate_full        = false;
+  #endif
+
   data.sensor.CalcDerivedParameters();
 
   if (printer.isRunning()) return; // All running not reinitialize
 
+  #if ENABLED(HEATER_TELEMETRY)
+    telemetry.reset();
+  #endif
+
   if (data.pin > 0) HAL::pinMode(data.pin, (isHWinvert()) ? OUTPUT_HIGH : OUTPUT_LOW);
 
   #if HAS_MAX6675 || HAS_MAX31855
@@ -194,6 +205,9 @@ void Heater::get_output() {
             #if ENABLED(PID_ADD_EXTRUSION_RATE)
               , 0xFF
             #endif
+            #if ENABLED(HEATER_TELEMETRY)
+              , &telemetry.terms
+            #endif
           );
         }
         else if (expired(&next_check_ms, temp_check_interval)) {
@@ -214,6 +228,9 @@ void Heater::get_output() {
             #if ENABLED(PID_ADD_EXTRUSION_RATE)
               , id
             #endif
+            #if ENABLED(HEATER_TELEMETRY)
+              , &telemetry.terms
+            #endif
           );
         }
         else if (expired(&next_check_ms, temp_check_interval)) {
@@ -266,6 +283,14 @@ void Heater::check_and_power() {
 
   get_output();
 
+  #if ENABLED(CONCURRENT_PREHEAT)
+    update_heat_rate();
+  #endif
+
+  #if ENABLED(HEATER_TELEMETRY)
+    if (isActive()) telemetry.add(current_temperature, isIdle() ? idle_temperature : target_temperature, pwm_value);
+  #endif
+
   // Make sure temperature is increasing
   if (isThermalProtection() && watch_next_ms && expired(&watch_next_ms, millis_s(watch_period * 1000U))) {
     if (current_temperature < watch_target_temp)
@@ -605,6 +630,24 @@ void Heater::print_M306() {
 
 }
 
+#if ENABLED(SENSOR_CALIBRATION)
+  void Heater::print_M309() {
+    const int8_t heater_id = type == IS_HOTEND ? data.ID : -type;
+    SERIAL_SM(CFG, "Heater Sensor calibration: H<Heater>");
+    if (heater_id < 0) SERIAL_MSG(" T<tools>");
+    SERIAL_EM(" P<Sensor temp> A<Actual temp>:");
+    SERIAL_SMV(CFG, "  M309 H", (int)heater_id);
+    if (heater_id < 0) SERIAL_MV(" T", int(data.ID));
+    SERIAL_EM(" R");
+    for (uint8_t i = 0; i < data.sensor.cal_count; i++) {
+      SERIAL_SMV(CFG, "  M309 H", (int)heater_id);
+      if (heater_id < 0) SERIAL_MV(" T", int(data.ID));
+      SERIAL_MV(" P", data.sensor.cal_measured[i] * 0.1f, 1);
+      SERIAL_EMV(" A", data.sensor.cal_actual[i] * 0.1f, 1);
+    }
+  }
+#endif
+
 #if HAS_AD8495 || HAS_AD595
   void Heater::print_M595() {
     const int8_t heater_id = type == IS_HOTEND ? data.ID : -type;
@@ -619,6 +662,72 @@ void Heater::print_M306() {
   }
 #endif
 
+#if HAS_HEATER_WATTS
+
+  /**
+   * Nominal power of the heater in Watt
+   */
+  uint16_t Heater::get_watts() {
+    switch (type) {
+      case IS_HOTEND:   return HOTEND_WATTS;
+      #if BEDS > 0
+        case IS_BED:    return BED_WATTS;
+      #endif
+      #if CHAMBERS > 0
+        case IS_CHAMBER:  return CHAMBER_WATTS;
+      #endif
+      default: return 0;
+    }
+  }
+
+#endif // HAS_HEATER_WATTS
+
+#if ENABLED(HEATERS_POWER_ARBITER)
+
+  /**
+   * Cut the output to pwm after the PID has run.
+   * The PID and the telemetry are told the output really applied.
+   */
+  void Heater::limit_output(const uint8_t pwm) {
+    if (pwm >= pwm_value) return;
+    if (isUsePid())
+      data.pid.limited(pwm_value, isIdle() ? idle_temperature : target_temperature, current_temperature);
+    pwm_value = pwm;
+    #if ENABLED(HEATER_TELEMETRY)
+      telemetry.set_last_pwm(pwm);
+    #endif
+  }
+
+#endif // HEATERS_POWER_ARBITER
+
+#if ENABLED(CONCURRENT_PREHEAT)
+
+  /**
+   * Predicted time in seconds to heat from the current temperature to celsius.
+   * Use the measured heating rate or the default rate if not yet measured.
+   */
+  uint16_t Heater::heating_time(const int16_t celsius) {
+    const float delta = celsius - current_temperature;
+    if (delta <= 0) return 0;
+
+    float rate = heat_rate;
+    if (rate <= 0) {
+      switch (type) {
+        #if BEDS > 0
+          case IS_BED:      rate = PREHEAT_BED_RATE;     break;
+        #endif
+        #if CHAMBERS > 0
+          case IS_CHAMBER:  rate = PREHEAT_CHAMBER_RATE; break;
+        #endif
+        default:            rate = PREHEAT_HOTEND_RATE;  break;
+      }
+    }
+
+    return MIN(delta / rate, 65535.0f);
+  }
+
+#endif // ENABLED(CONCURRENT_PREHEAT)
+
 void Heater::start_idle_timer(const millis_l &ms) {
   idle_timeout_ms = millis() + ms;
   setIdle(false);
@@ -670,6 +779,9 @@ void Heater::thermal_runaway_protection() {
       }
       else if (pending(&thermal_runaway_ms, millis_l(THERMAL_PROTECTION_PERIOD * 1000UL))) break;
       thermal_runaway_state = TRRunaway;
+      #if ENABLED(HEATER_TELEMETRY)
+        telemetry.freeze();
+      #endif
 
     default: break;
   }
@@ -697,6 +809,11 @@ void Heater::start_watching() {
 /** Private Function */
 // Temperature Error Handlers
 void Heater::_temp_error(PGM_P const serial_msg, PGM_P const lcd_msg) {
+
+  #if ENABLED(HEATER_TELEMETRY)
+    telemetry.freeze();
+  #endif
+
   if (isActive()) {
     SERIAL_STR(ER);
     SERIAL_STR(serial_msg);
@@ -777,4 +894,24 @@ void Heater::update_idle_timer() {
     setIdle(true);
 }
 
+#if ENABLED(CONCURRENT_PREHEAT)
+
+  /**
+   * Learn the heating rate, only over seconds with the heater at full power
+   */
+  void Heater::update_heat_rate() {
+    if (!expired(&heat_rate_ms, 1000U)) return;
+
+    const float delta = current_temperature - heat_rate_temp;
+    const bool  full  = isActive() && pwm_value >= data.pid.Max;
+
+    if (full && heat_rate_full && delta > 0)
+      heat_rate = (heat_rate > 0) ? heat_rate * 0.75f + delta * 0.25f : delta;
+
+    heat_rate_temp = current_temperature;
+    heat_rate_full = full;
+  }
+
+#endif
+
 #endif // HEATER_COUNT > 0
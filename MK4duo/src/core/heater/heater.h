@@ -29,6 +29,7 @@
 
 #include "sensor/sensor.h"
 #include "pid/pid.h"
+#include "telemetry/telemetry.h"
 
 union flagheater_t {
   uint8_t all;
@@ -86,6 +87,14 @@ class Heater {
 
     float           current_temperature;
 
+    #if ENABLED(HEATER_TELEMETRY)
+      heater_telemetry_t telemetry;
+    #endif
+
+    #if ENABLED(CONCURRENT_PREHEAT)
+      float         heat_rate;  // Measured heating rate at full power (degC/s)
+    #endif
+
     const HeatertypeEnum type;
 
   private: /** Private Parameters */
@@ -103,6 +112,12 @@ class Heater {
 
     bool            Pidtuning;
 
+    #if ENABLED(CONCURRENT_PREHEAT)
+      millis_s      heat_rate_ms;
+      float         heat_rate_temp;
+      bool          heat_rate_full;
+    #endif
+
   public: /** Public Function */
 
     void init();
@@ -116,6 +131,9 @@ class Heater {
     void print_M301();
     void print_M305();
     void print_M306();
+    #if ENABLED(SENSOR_CALIBRATION)
+      void print_M309();
+    #endif
     #if HAS_AD8495 || HAS_AD595
       void print_M595();
     #endif
@@ -126,6 +144,16 @@ class Heater {
     void thermal_runaway_protection();
     void start_watching();
 
+    #if HAS_HEATER_WATTS
+      uint16_t get_watts();
+    #endif
+    #if ENABLED(HEATERS_POWER_ARBITER)
+      void limit_output(const uint8_t pwm);
+    #endif
+    #if ENABLED(CONCURRENT_PREHEAT)
+      uint16_t heating_time(const int16_t celsius);
+    #endif
+
     FORCE_INLINE void update_current_temperature() { this->current_temperature = this->data.sensor.getTemperature(); }
     FORCE_INLINE bool tempisrange() { return (WITHIN(this->current_temperature, this->data.mintemp, this->data.maxtemp)); }
     FORCE_INLINE bool isHeating()   { return this->target_temperature > this->current_temperature; }
@@ -200,6 +228,10 @@ class Heater {
 
     void update_idle_timer();
 
+    #if ENABLED(CONCURRENT_PREHEAT)
+      void update_heat_rate();
+    #endif
+
 };
 
 extern Heater hotends[HOTENDS];
@@ -31,6 +31,11 @@
   static int  lpq_ptr           = 0;
 #endif
 
+#if ENABLED(HEATER_TELEMETRY)
+  // Last P I D terms, in PWM units
+  typedef struct { float P, I, D; } pid_terms_t;
+#endif
+
 typedef struct {
 
   public: /** Public Parameters */
@@ -54,6 +59,9 @@ typedef struct {
       #if ENABLED(PID_ADD_EXTRUSION_RATE)
         , const uint8_t tid
       #endif
+      #if ENABLED(HEATER_TELEMETRY)
+        , pid_terms_t * const terms=nullptr
+      #endif
     ) {
 
       static millis_s cycle_1s_ms = 0;
@@ -61,6 +69,10 @@ typedef struct {
 
       const float pid_error = target_temp - current_temp;
 
+      #if ENABLED(HEATER_TELEMETRY)
+        float pTerm = 0.0, iTerm = 0.0, dTerm = 0.0;
+      #endif
+
       if (pid_error > PID_FUNCTIONAL_RANGE) {
         pid_output = Max;
         tempIState = tempIStateLimitMin;
@@ -74,6 +86,12 @@ typedef struct {
         float dgain = Kd * (last_temperature - temperature_1s);
         pid_output += dgain;
 
+        #if ENABLED(HEATER_TELEMETRY)
+          pTerm = Kp * pid_error;
+          iTerm = Ki * tempIState * 0.1;
+          dTerm = dgain;
+        #endif
+
         #if ENABLED(PID_ADD_EXTRUSION_RATE)
           if (tid == ACTIVE_HOTEND) {
             const long e_position = stepper.position(E_AXIS);
@@ -99,6 +117,14 @@ typedef struct {
         }
       }
 
+      #if ENABLED(HEATER_TELEMETRY)
+        if (terms) {
+          terms->P = pTerm;
+          terms->I = iTerm;
+          terms->D = dTerm;
+        }
+      #endif
+
       if (expired(&cycle_1s_ms, 1000U)) {
         last_temperature = temperature_1s;
         temperature_1s = current_temp;
@@ -107,6 +133,20 @@ typedef struct {
       return pid_output;
     }
 
+    #if ENABLED(HEATERS_POWER_ARBITER)
+      /**
+       * The output was cut below pid_output outside the loop (power arbiter).
+       * Take back the last integration as on saturation, so the I term
+       * doesn't wind up while the heater is held under the budget.
+       */
+      void limited(const uint8_t pid_output, const int16_t target_temp, const float current_temp) {
+        const float pid_error = target_temp - current_temp;
+        // At Max or out of the functional range spin() didn't integrate
+        if (pid_output < Max && pid_error > 0 && pid_error <= PID_FUNCTIONAL_RANGE)
+          tempIState -= pid_error;
+      }
+    #endif
+
     void update() {
       if (Ki != 0) {
         tempIStateLimitMin = (float)DriveMin * 10.0f / Ki;
@@ -48,4 +48,34 @@
   #endif
 #endif
 
+// Heater telemetry
+#if ENABLED(HEATER_TELEMETRY)
+  #if DISABLED(HEATER_TELEMETRY_SAMPLES)
+    #error "DEPENDENCY ERROR: Missing setting HEATER_TELEMETRY_SAMPLES."
+  #elif !WITHIN(HEATER_TELEMETRY_SAMPLES, 2, 255)
+    #error "DEPENDENCY ERROR: HEATER_TELEMETRY_SAMPLES must be between 2 and 255."
+  #endif
+#endif
+
+// Heaters power
+#if HAS_HEATER_WATTS
+  #if DISABLED(HOTEND_WATTS) || DISABLED(BED_WATTS) || DISABLED(CHAMBER_WATTS) || DISABLED(HEATERS_POWER_BUDGET)
+    #error "DEPENDENCY ERROR: Missing setting HOTEND_WATTS, BED_WATTS, CHAMBER_WATTS or HEATERS_POWER_BUDGET."
+  #endif
+#endif
+
+// Power arbiter
+#if ENABLED(HEATERS_POWER_ARBITER)
+  #if DISABLED(HOTEND_POWER_PRIORITY) || DISABLED(BED_POWER_PRIORITY) || DISABLED(CHAMBER_POWER_PRIORITY)
+    #error "DEPENDENCY ERROR: Missing setting HOTEND_POWER_PRIORITY, BED_POWER_PRIORITY or CHAMBER_POWER_PRIORITY."
+  #endif
+#endif
+
+// Concurrent preheat
+#if ENABLED(CONCURRENT_PREHEAT)
+  #if DISABLED(PREHEAT_HOTEND_RATE) || DISABLED(PREHEAT_BED_RATE) || DISABLED(PREHEAT_CHAMBER_RATE) || DISABLED(PREHEAT_START_LEAD)
+    #error "DEPENDENCY ERROR: Missing setting PREHEAT_HOTEND_RATE, PREHEAT_BED_RATE, PREHEAT_CHAMBER_RATE or PREHEAT_START_LEAD."
+  #endif
+#endif
+
 #endif /* _HEATER_SANITYCHECK_H_ */
@@ -95,4 +95,13 @@
   #endif // HOTENDS > 1
 #endif // HOTENDS > 0
 
+// Sensor calibration
+#if ENABLED(SENSOR_CALIBRATION)
+  #if DISABLED(SENSOR_CALIBRATION_POINTS)
+    #error "DEPENDENCY ERROR: Missing setting SENSOR_CALIBRATION_POINTS."
+  #elif !WITHIN(SENSOR_CALIBRATION_POINTS, 2, 16)
+    #error "DEPENDENCY ERROR: SENSOR_CALIBRATION_POINTS must be between 2 and 16."
+  #endif
+#endif
+
 #endif /* _TEMP_SENSOR_SANITYCHECK_H_ */
@@ -50,6 +50,12 @@ typedef struct {
             ad595_gain;
     #endif
 
+    #if ENABLED(SENSOR_CALIBRATION)
+      uint8_t cal_count;
+      int16_t cal_measured[SENSOR_CALIBRATION_POINTS],  // Sensor temperature in tenths, ascending
+              cal_actual[SENSOR_CALIBRATION_POINTS];    // Reference temperature in tenths
+    #endif
+
   public: /** Public Function */
 
     void CalcDerivedParameters() {
@@ -59,6 +65,14 @@ typedef struct {
     }
 
     float getTemperature() {
+      #if ENABLED(SENSOR_CALIBRATION)
+        return calibrate(getSensorTemperature());
+      #else
+        return getSensorTemperature();
+      #endif
+    }
+
+    float getSensorTemperature() {
 
       #if HAS_MAX6675 || HAS_MAX31855
         if (type == -4 || type == -3)
@@ -107,25 +121,25 @@ typedef struct {
       #if HAS_AMPLIFIER
 
         #define PGM_RD_W(x) (short)pgm_read_word(&x)
-        static uint8_t  ttbllen_map = COUNT(temptable_amplifier);
-        float celsius = 0;
-        uint8_t i;
 
         if (type == 20) {
-          for (i = 1; i < ttbllen_map; i++) {
-            if (PGM_RD_W(temptable_amplifier[i][0]) > raw) {
-              celsius = PGM_RD_W(temptable_amplifier[i - 1][1]) +
-                        (raw - PGM_RD_W(temptable_amplifier[i - 1][0])) *
-                        (float)(PGM_RD_W(temptable_amplifier[i][1]) - PGM_RD_W(temptable_amplifier[i - 1][1])) /
-                        (float)(PGM_RD_W(temptable_amplifier[i][0]) - PGM_RD_W(temptable_amplifier[i - 1][0]));
-              break;
-            }
-          }
+          constexpr uint8_t ttbllen_map = COUNT(temptable_amplifier);
 
           // Overflow: Set to last value in the table
-          if (i == ttbllen_map) celsius = PGM_RD_W(temptable_amplifier[i - 1][1]);
+          if (raw >= PGM_RD_W(temptable_amplifier[ttbllen_map - 1][0]))
+            return PGM_RD_W(temptable_amplifier[ttbllen_map - 1][1]);
+
+          // Binary search the segment with l <= raw < r
+          uint8_t l = 0, r = ttbllen_map - 1;
+          while (r - l > 1) {
+            const uint8_t m = (l + r) >> 1;
+            if (PGM_RD_W(temptable_amplifier[m][0]) > raw) r = m; else l = m;
+          }
 
-          return celsius;
+          return PGM_RD_W(temptable_amplifier[l][1]) +
+                 (raw - PGM_RD_W(temptable_amplifier[l][0])) *
+                 (float)(PGM_RD_W(temptable_amplifier[r][1]) - PGM_RD_W(temptable_amplifier[l][1])) /
+                 (float)(PGM_RD_W(temptable_amplifier[r][0]) - PGM_RD_W(temptable_amplifier[l][0]));
         }
 
       #endif // HAS_AMPLIFIER
@@ -136,18 +150,73 @@ typedef struct {
       return 25;
     }
 
+    #if ENABLED(SENSOR_CALIBRATION)
+
+      /**
+       * Piecewise linear correction of the sensor temperature.
+       * One point is a plain offset, out of the table the first
+       * or last segment is extended.
+       */
+      float calibrate(const float celsius) {
+        if (cal_count == 0) return celsius;
+        if (cal_count == 1) return celsius + (cal_actual[0] - cal_measured[0]) * 0.1f;
+
+        const float t = celsius * 10.0f;
+
+        // Binary search the segment
+        uint8_t l = 0, r = cal_count - 1;
+        while (r - l > 1) {
+          const uint8_t m = (l + r) >> 1;
+          if (t < cal_measured[m]) r = m; else l = m;
+        }
+
+        return (cal_actual[l] + (t - cal_measured[l]) * float(cal_actual[r] - cal_actual[l]) / float(cal_measured[r] - cal_measured[l])) * 0.1f;
+      }
+
+      /**
+       * Add a calibration point keeping the table sorted,
+       * a point with the same sensor temperature is replaced.
+       * Return false if the table is full.
+       */
+      bool set_cal_point(const float measured, const float actual) {
+        const int16_t m = LROUND(measured * 10.0f),
+                      a = LROUND(actual * 10.0f);
+        uint8_t i = 0;
+        while (i < cal_count && cal_measured[i] < m) i++;
+
+        if (i < cal_count && cal_measured[i] == m) {
+          cal_actual[i] = a;
+          return true;
+        }
+
+        if (cal_count >= SENSOR_CALIBRATION_POINTS) return false;
+
+        for (uint8_t j = cal_count; j > i; j--) {
+          cal_measured[j] = cal_measured[j - 1];
+          cal_actual[j]   = cal_actual[j - 1];
+        }
+        cal_measured[i] = m;
+        cal_actual[i]   = a;
+        cal_count++;
+        return true;
+      }
+
+      void reset_cal() { cal_count = 0; }
+
+    #endif // ENABLED(SENSOR_CALIBRATION)
+
+    #if HAS_MAX6675 || HAS_MAX31855
+      #define SPI_SENSOR_INTERVAL   250u  // Every thermocouple is read every 250ms
+    #endif
+
     #if HAS_MAX6675
 
-      #define MAX6675_HEAT_INTERVAL 250u
       #define MAX6675_ERROR_MASK      4
       #define MAX6675_DISCARD_BITS    3
 
       int16_t read_max6675() {
 
-        static millis_s next_max6675_ms = 0;
-        static uint16_t max6675_temp    = 2000;
-
-        if (pending(&next_max6675_ms, MAX6675_HEAT_INTERVAL)) return int16_t(max6675_temp);
+        uint16_t max6675_temp = 0;
 
         #if ENABLED(CPU_32_BIT)
           HAL::spiBegin();
@@ -168,7 +237,6 @@ typedef struct {
         HAL::delayNanoseconds(100);
 
         // Read a big-endian temperature value
-        max6675_temp = 0;
         for (uint8_t i = sizeof(max6675_temp); i--;) {
           #if ENABLED(CPU_32_BIT)
             max6675_temp |= HAL::spiReceive();
@@ -197,17 +265,12 @@ typedef struct {
 
     #if HAS_MAX31855
 
-      #define MAX31855_HEAT_INTERVAL 250u
       #define MAX31855_DISCARD_BITS 18
 
       int16_t read_max31855() {
 
-        static millis_s next_max31855_ms    = 0;
-        static uint16_t last_max31855_temp  = 2000;
-
-        uint32_t data = 0;
-
-        if (pending(&next_max31855_ms, MAX31855_HEAT_INTERVAL)) return int16_t(last_max31855_temp);
+        uint16_t  max31855_temp = 0;
+        uint32_t  data          = 0;
 
         #if ENABLED(CPU_32_BIT)
           HAL::spiBegin();
@@ -239,15 +302,15 @@ typedef struct {
           return 20000; // Some form of error.
         else {
           data = data >> MAX31855_DISCARD_BITS;
-          last_max31855_temp = data & 0x00001FFF;
+          max31855_temp = data & 0x00001FFF;
 
           if (data & 0x00002000) {
             data = ~data;
-            last_max31855_temp = -1 * ((data & 0x00001FFF) + 1);
+            max31855_temp = -1 * ((data & 0x00001FFF) + 1);
           }
         }
 
-        return int16_t(last_max31855_temp);
+        return int16_t(max31855_temp);
       }
 
     #endif // HAS_MAX6675
@@ -0,0 +1,127 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * telemetry.h - heater telemetry ring object
+ *
+ * Every call of the heater control loop stores one sample with
+ * temperature, target, PWM output and the P I D terms.
+ * The ring is frozen on a heater fault so the samples that led to
+ * the error can be read back with M310.
+ */
+
+#if ENABLED(HEATER_TELEMETRY)
+
+// Sample: temperatures and PID terms are stored in tenths
+typedef struct {
+  millis_s  time;
+  int16_t   temperature,
+            target,
+            Pterm,
+            Iterm,
+            Dterm;
+  uint8_t   pwm;
+} telemetry_sample_t;
+
+typedef struct {
+
+  public: /** Public Parameters */
+
+    pid_terms_t terms;
+
+  private: /** Private Parameters */
+
+    telemetry_sample_t  sample[HEATER_TELEMETRY_SAMPLES];
+    uint8_t             head,
+                        count;
+    volatile bool       frozen,
+                        dumping;
+
+  public: /** Public Function */
+
+    void reset() {
+      head    = 0;
+      count   = 0;
+      frozen  = false;
+      dumping = false;
+      terms.P = terms.I = terms.D = 0.0f;
+    }
+
+    void freeze() { frozen = true; }
+    bool isFrozen() { return frozen; }
+
+    /**
+     * Called from the heater control loop (Temperature ISR)
+     */
+    void add(const float current_temp, const int16_t target_temp, const uint8_t pwm) {
+      if (frozen || dumping) return;
+      telemetry_sample_t &s = sample[head];
+      s.time        = millis();
+      s.temperature = current_temp * 10.0f;
+      s.target      = target_temp * 10;
+      s.Pterm       = terms.P * 10.0f;
+      s.Iterm       = terms.I * 10.0f;
+      s.Dterm       = terms.D * 10.0f;
+      s.pwm         = pwm;
+      if (++head >= HEATER_TELEMETRY_SAMPLES) head = 0;
+      if (count < HEATER_TELEMETRY_SAMPLES) count++;
+    }
+
+    /**
+     * The output of the newest sample was changed after add() (power arbiter)
+     */
+    void set_last_pwm(const uint8_t pwm) {
+      if (frozen || dumping || !count) return;
+      sample[(head + HEATER_TELEMETRY_SAMPLES - 1) % HEATER_TELEMETRY_SAMPLES].pwm = pwm;
+    }
+
+    /**
+     * Print the ring as CSV, oldest sample first.
+     * Time is in ms relative to the newest sample.
+     */
+    void dump() {
+      dumping = true;
+      SERIAL_MV("TLM frozen:", int(frozen));
+      SERIAL_EMV(" samples:", int(count));
+      SERIAL_EM("ms,temp,target,pwm,p,i,d");
+      if (count) {
+        uint8_t idx = (head + HEATER_TELEMETRY_SAMPLES - count) % HEATER_TELEMETRY_SAMPLES;
+        const millis_s last = sample[(head + HEATER_TELEMETRY_SAMPLES - 1) % HEATER_TELEMETRY_SAMPLES].time;
+        for (uint8_t i = 0; i < count; i++) {
+          const telemetry_sample_t &s = sample[idx];
+          SERIAL_VAL(-int32_t(millis_s(last - s.time)));
+          SERIAL_MV(",", s.temperature * 0.1f, 1);
+          SERIAL_MV(",", s.target * 0.1f, 1);
+          SERIAL_MV(",", int(s.pwm));
+          SERIAL_MV(",", s.Pterm * 0.1f, 1);
+          SERIAL_MV(",", s.Iterm * 0.1f, 1);
+          SERIAL_EMV(",", s.Dterm * 0.1f, 1);
+          if (++idx >= HEATER_TELEMETRY_SAMPLES) idx = 0;
+        }
+      }
+      dumping = false;
+    }
+
+} heater_telemetry_t;
+
+#endif // ENABLED(HEATER_TELEMETRY)
@@ -392,7 +392,12 @@ bool Core_Mechanics::prepare_move_to_destination_mech_specific() {
   #endif
 
   #if HAS_MESH
-    if (bedlevel.flag.leveling_active && bedlevel.leveling_active_at_z(destination[Z_AXIS])) {
+    if (bedlevel.flag.leveling_active && bedlevel.leveling_active_at_z(destination[Z_AXIS])
+      #if ENABLED(MESH_SEGMENT_TOLERANCE)
+        // Flat enough along the move: no split, the planner levels both ends
+        && !bedlevel.correction_is_linear(current_position, destination)
+      #endif
+    ) {
       #if ENABLED(AUTO_BED_LEVELING_UBL)
         ubl.line_to_destination_cartesian(MMS_SCALED(feedrate_mm_s), tools.active_extruder);
         return true;
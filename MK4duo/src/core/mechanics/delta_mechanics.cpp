@@ -189,6 +189,11 @@ void Delta_Mechanics::get_cartesian_from_steppers() {
     // Now compute the number of lines needed
     uint16_t numLines = (segments + data.segments_per_line - 1) / data.segments_per_line;
 
+    // Fewer lines where the tower motion is close to linear
+    #if ENABLED(KINEMATIC_SEGMENT_DEVIATION)
+      NOMORE(numLines, deviation_lines(difference, cartesian_distance));
+    #endif
+
     // The approximate length of each segment
     const float inv_numLines = 1.0f / float(numLines),
                 segment_distance[XYZE] = {
@@ -231,6 +236,51 @@ void Delta_Mechanics::get_cartesian_from_steppers() {
 
   }
 
+  #if ENABLED(KINEMATIC_SEGMENT_DEVIATION)
+
+    /**
+     * Number of lines that keeps every straight tower move
+     * within KINEMATIC_SEGMENT_DEVIATION of the Cartesian line.
+     *
+     * Along the unit direction u the tower height is z + s,
+     * with d the XY distance from the tower and s = sqrt(rod² - d²).
+     * Its second derivative is -(|u|² / s + (d·u)² / s³), and a chord
+     * of length l misses the curve by l² |h''| / 8.
+     * d² and (d·u)² are convex along a line, so the smallest s and
+     * the largest d·u at the two ends bound the curvature of the
+     * whole move.
+     */
+    uint16_t Delta_Mechanics::deviation_lines(const float difference[XYZE], const float cartesian_distance) {
+
+      const float inv_distance  = 1.0f / cartesian_distance,
+                  ux            = difference[X_AXIS] * inv_distance,
+                  uy            = difference[Y_AXIS] * inv_distance,
+                  uxy2          = HYPOT2(ux, uy);
+
+      float max_curvature = 0.0f;
+
+      LOOP_ABC(tower) {
+        float min_s2 = delta_diagonal_rod_2[tower],
+              max_dot2 = 0.0f;
+        for (uint8_t end = 0; end < 2; end++) {
+          const float dx = current_position[X_AXIS] + (end ? difference[X_AXIS] : 0.0f) - towerX[tower],
+                      dy = current_position[Y_AXIS] + (end ? difference[Y_AXIS] : 0.0f) - towerY[tower];
+          NOMORE(min_s2, delta_diagonal_rod_2[tower] - HYPOT2(dx, dy));
+          NOLESS(max_dot2, sq(dx * ux + dy * uy));
+        }
+        if (min_s2 <= 0.0f) return UINT16_MAX;
+        const float min_s = SQRT(min_s2);
+        NOLESS(max_curvature, uxy2 / min_s + max_dot2 / (min_s2 * min_s));
+      }
+
+      if (max_curvature <= 0.0f) return 1;
+
+      const float max_line_mm = SQRT(8.0f * float(KINEMATIC_SEGMENT_DEVIATION) / max_curvature);
+      return MAX(1.0f, CEIL(MIN(cartesian_distance / max_line_mm, float(UINT16_MAX))));
+    }
+
+  #endif // ENABLED(KINEMATIC_SEGMENT_DEVIATION)
+
 #endif // DISABLED(AUTO_BED_LEVELING_UBL)
 
 /**
@@ -202,6 +202,10 @@ class Delta_Mechanics : public Mechanics {
      */
     static void Set_clip_start_height();
 
+    #if ENABLED(KINEMATIC_SEGMENT_DEVIATION) && DISABLED(AUTO_BED_LEVELING_UBL)
+      static uint16_t deviation_lines(const float difference[XYZE], const float cartesian_distance);
+    #endif
+
     #if ENABLED(DELTA_FAST_SQRT) && ENABLED(__AVR__)
       static float Q_rsqrt(float number);
     #endif
@@ -615,4 +615,16 @@
 
 #endif // IS_SCARA
 
+/**
+ * Kinematic segment deviation
+ */
+#if ENABLED(KINEMATIC_SEGMENT_DEVIATION)
+  #if !IS_KINEMATIC
+    #error "DEPENDENCY ERROR: KINEMATIC_SEGMENT_DEVIATION is only for Delta and SCARA machines."
+  #elif ENABLED(AUTO_BED_LEVELING_UBL)
+    #error "DEPENDENCY ERROR: KINEMATIC_SEGMENT_DEVIATION is not compatible with AUTO_BED_LEVELING_UBL."
+  #endif
+  static_assert(KINEMATIC_SEGMENT_DEVIATION > 0, "DEPENDENCY ERROR: KINEMATIC_SEGMENT_DEVIATION must be greater than 0.");
+#endif
+
 #endif /* _MECH_SANITYCHECK_H_ */
@@ -30,6 +30,12 @@
 
 #if IS_SCARA
 
+#if ENABLED(SCARA_FAST_TRIG)
+  #define _ATAN2(y, x) fast_atan2(y, x)
+#else
+  #define _ATAN2(y, x) ATAN2(y, x)
+#endif
+
 Scara_Mechanics mechanics;
 
 /** Public Parameters */
@@ -170,6 +176,11 @@ void Scara_Mechanics::get_cartesian_from_steppers() {
     // For SCARA minimum segment size is 0.5mm
     NOMORE(segments, cartesian_mm * 2);
 
+    // Fewer segments where the arm motion is close to linear
+    #if ENABLED(KINEMATIC_SEGMENT_DEVIATION)
+      NOMORE(segments, deviation_segments(difference));
+    #endif
+
     // At least one segment is required
     NOLESS(segments, 1U);
 
@@ -264,6 +275,45 @@ void Scara_Mechanics::get_cartesian_from_steppers() {
     return false; // caller will update current_position
   }
 
+  #if ENABLED(KINEMATIC_SEGMENT_DEVIATION)
+
+    /**
+     * Number of segments that keeps every straight arm move
+     * within KINEMATIC_SEGMENT_DEVIATION of the Cartesian line.
+     *
+     * Each half of the move is done as one arm move and the
+     * midpoint of the arm angles is converted back to XY.
+     * The distance from the Cartesian midpoint shrinks with
+     * the square of the segment length.
+     */
+    uint16_t Scara_Mechanics::deviation_segments(const float difference[XYZE]) {
+
+      float raw[XYZ] = { current_position[X_AXIS], current_position[Y_AXIS], current_position[Z_AXIS] },
+            angle[3][2];
+
+      for (uint8_t i = 0; i < 3; i++) {
+        raw[X_AXIS] = current_position[X_AXIS] + difference[X_AXIS] * 0.5f * i;
+        raw[Y_AXIS] = current_position[Y_AXIS] + difference[Y_AXIS] * 0.5f * i;
+        Transform(raw);
+        angle[i][0] = delta[A_AXIS];
+        angle[i][1] = delta[B_AXIS];
+      }
+
+      float max_dev2 = 0.0f;
+      for (uint8_t h = 0; h < 2; h++) {
+        float cartesian[XYZ];
+        InverseTransform((angle[h][0] + angle[h + 1][0]) * 0.5f, (angle[h][1] + angle[h + 1][1]) * 0.5f, cartesian);
+        const float t = 0.25f + 0.5f * h;
+        NOLESS(max_dev2, HYPOT2(cartesian[X_AXIS] - (current_position[X_AXIS] + difference[X_AXIS] * t),
+                                cartesian[Y_AXIS] - (current_position[Y_AXIS] + difference[Y_AXIS] * t)));
+      }
+
+      const float per_half = CEIL(SQRT(SQRT(max_dev2) / float(KINEMATIC_SEGMENT_DEVIATION)));
+      return 2 * MAX(1.0f, MIN(per_half, float(UINT16_MAX / 2)));
+    }
+
+  #endif // ENABLED(KINEMATIC_SEGMENT_DEVIATION)
+
 #endif // DISABLED(AUTO_BED_LEVELING_UBL)
 
 /**
@@ -357,10 +407,10 @@ void Scara_Mechanics::Transform(const float raw[XYZ]) {
   SK2 = L2 * S2;
 
   // Angle of Arm1 is the difference between Center-to-End angle and the Center-to-Elbow
-  THETA = ATAN2(SK1, SK2) - ATAN2(sx, sy);
+  THETA = _ATAN2(SK1, SK2) - _ATAN2(sx, sy);
 
   // Angle of Arm2
-  PSI = ATAN2(S2, C2);
+  PSI = _ATAN2(S2, C2);
 
   delta[A_AXIS] = DEGREES(THETA);        // theta is support arm angle
   delta[B_AXIS] = DEGREES(THETA + PSI);  // equal to sub arm angle (inverted motor)
@@ -913,4 +963,24 @@ void Scara_Mechanics::homeaxis(const AxisEnum axis) {
 
 }
 
+#if ENABLED(SCARA_FAST_TRIG)
+
+  /**
+   * Polynomial atan2: minimax fit of atan(z) on [0, 1]
+   * with octant reduction. Max error 2e-6 rad.
+   */
+  float Scara_Mechanics::fast_atan2(const float y, const float x) {
+    const float ax = ABS(x), ay = ABS(y);
+    if (ax == 0.0f && ay == 0.0f) return 0.0f;
+    const bool swap = ay > ax;
+    const float z   = swap ? ax / ay : ay / ax,
+                z2  = sq(z);
+    float a = z * (0.99997726f + z2 * (-0.33262347f + z2 * (0.19354346f + z2 * (-0.11643287f + z2 * (0.05265332f + z2 * -0.01172120f)))));
+    if (swap) a = float(M_PI) * 0.5f - a;
+    if (x < 0.0f) a = float(M_PI) - a;
+    return y < 0.0f ? -a : a;
+  }
+
+#endif
+
 #endif // IS_SCARA
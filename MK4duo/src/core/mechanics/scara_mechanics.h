@@ -163,6 +163,14 @@ class Scara_Mechanics : public Mechanics {
 
   private: /** Private Function */
 
+    #if ENABLED(SCARA_FAST_TRIG)
+      static float fast_atan2(const float y, const float x);
+    #endif
+
+    #if ENABLED(KINEMATIC_SEGMENT_DEVIATION) && DISABLED(AUTO_BED_LEVELING_UBL)
+      static uint16_t deviation_segments(const float difference[XYZE]);
+    #endif
+
     /**
      *  Home axis
      */
@@ -550,6 +550,10 @@ void Printer::idle(const bool ignore_stepper_queue/*=false*/) {
 
   commands.get_available();
 
+  #if ENABLED(SD_IO_WORKER)
+    sdworker.spin();
+  #endif
+
   handle_safety_watch();
 
   if (expired(&max_inactivity_ms, millis_l(max_inactive_time * 1000UL))) {
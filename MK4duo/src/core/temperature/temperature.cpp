@@ -169,6 +169,10 @@ void Temperature::spin() {
     } // LOOP_COOLER
   #endif
 
+  #if ENABLED(HEATERS_POWER_ARBITER)
+    powerArbiter.spin();
+  #endif
+
   #if HAS_MCU_TEMPERATURE
     mcu_current_temperature = analog2tempMCU(mcu_current_temperature_raw);
     NOLESS(mcu_highest_temperature, mcu_current_temperature);
@@ -293,6 +297,165 @@ bool Temperature::heaters_isActive() {
   return false;
 }
 
+#if ENABLED(CONCURRENT_PREHEAT)
+
+  /**
+   * Concurrent preheat
+   *
+   * All heaters with a target are switched off and started again one by one
+   * so that they reach the target together with the slowest one.
+   * A heater is started when its predicted heating time reaches the remaining
+   * time of the heaters already running and its power fits in the budget.
+   */
+  void Temperature::wait_heaters_concurrent() {
+
+    Heater*   list[HEATER_COUNT];
+    int16_t   target[HEATER_COUNT];
+    bool      started[HEATER_COUNT];
+    uint8_t   count = 0;
+
+    #define ADD_HEATER(H) do{ \
+      if (H.isActive() && H.isHeating()) { \
+        list[count] = &H; \
+        target[count] = H.target_temperature; \
+        started[count] = false; \
+        H.setTarget(0); \
+        count++; \
+      } \
+    }while(0)
+
+    #if HOTENDS > 0
+      LOOP_HOTEND() ADD_HEATER(hotends[h]);
+    #endif
+    #if BEDS > 0
+      LOOP_BED() ADD_HEATER(beds[h]);
+    #endif
+    #if CHAMBERS > 0
+      LOOP_CHAMBER() ADD_HEATER(chambers[h]);
+    #endif
+
+    if (!count) return;
+
+    const bool oldReport = printer.isAutoreportTemp();
+
+    printer.setWaitForHeatUp(true);
+    printer.setAutoreportTemp(true);
+
+    millis_s  next_check_ms = 0;
+    uint8_t   pending       = count;
+
+    do {
+
+      printer.idle();
+      printer.reset_move_ms();  // Keep steppers powered
+
+      if (pending && expired(&next_check_ms, 1000U)) {
+
+        uint16_t  finish    = 0;
+        float     power     = 0;
+        bool      all_done  = true;
+
+        for (uint8_t i = 0; i < count; i++) {
+          if (!started[i]) continue;
+          Heater * const act = list[i];
+          NOLESS(finish, act->heating_time(target[i]));
+          power += act->get_watts() * act->pwm_value / 255.0f;
+          if (act->wait_for_heating()) all_done = false;
+        }
+
+        // Start the pending heaters, the slowest first
+        while (pending) {
+
+          uint8_t   sel   = count;
+          uint16_t  sel_t = 0;
+          for (uint8_t i = 0; i < count; i++) {
+            if (started[i]) continue;
+            const uint16_t t = list[i]->heating_time(target[i]);
+            if (sel == count || t > sel_t) { sel = i; sel_t = t; }
+          }
+
+          Heater * const act = list[sel];
+          const bool  none_running  = (pending == count),
+                      in_time       = sel_t == 0 || sel_t + (PREHEAT_START_LEAD) >= finish,
+                      in_budget     = power + act->get_watts() <= (HEATERS_POWER_BUDGET);
+
+          if (none_running || (in_time && (in_budget || all_done))) {
+            act->setTarget(target[sel]);
+            started[sel] = true;
+            pending--;
+            NOLESS(finish, sel_t);
+            power += act->get_watts();
+            all_done = false;
+            SERIAL_SMV(ECHO, "Preheat start ", act->type == IS_HOTEND ? 'T' : act->type == IS_BED ? 'B' : 'C');
+            SERIAL_VAL(int(act->data.ID));
+            SERIAL_EMV(" estimated time (s): ", finish);
+          }
+          else break;
+
+        }
+
+      }
+
+      // Exit when all heaters are started and at target
+      bool heating = pending > 0;
+      for (uint8_t i = 0; i < count && !heating; i++)
+        if (list[i]->wait_for_heating()) heating = true;
+      if (!heating) break;
+
+    } while (printer.isWaitForHeatUp());
+
+    // Aborted (M108) start all pending heaters anyway
+    for (uint8_t i = 0; i < count; i++)
+      if (!started[i]) list[i]->setTarget(target[i]);
+
+    if (printer.isWaitForHeatUp()) lcdui.reset_status();
+
+    printer.setAutoreportTemp(oldReport);
+
+  }
+
+#endif // ENABLED(CONCURRENT_PREHEAT)
+
+#if ENABLED(PROBE_SEQUENCE_OPTIMIZATION) && HEATER_COUNT > 0
+
+  /**
+   * Wait until every heater still heating is within the window of its target.
+   * G29 uses it to start probing while the heaters finish the last degrees,
+   * the following M190/M109 wait for the rest.
+   */
+  void Temperature::wait_heaters_near_target(const int16_t window) {
+
+    #define HEATER_FAR(H) (H.isActive() && H.target_temperature - H.current_temperature > window)
+
+    const bool oldReport = printer.isAutoreportTemp();
+
+    printer.setWaitForHeatUp(true);
+    printer.setAutoreportTemp(true);
+
+    do {
+
+      bool far = false;
+      #if HOTENDS > 0
+        LOOP_HOTEND() if (HEATER_FAR(hotends[h])) far = true;
+      #endif
+      #if BEDS > 0
+        LOOP_BED() if (HEATER_FAR(beds[h])) far = true;
+      #endif
+      #if CHAMBERS > 0
+        LOOP_CHAMBER() if (HEATER_FAR(chambers[h])) far = true;
+      #endif
+      if (!far) break;
+
+      printer.idle();
+      printer.reset_move_ms();  // Keep steppers powered
+
+    } while (printer.isWaitForHeatUp());
+
+    printer.setAutoreportTemp(oldReport);
+
+  }
+
+#endif // ENABLED(PROBE_SEQUENCE_OPTIMIZATION) && HEATER_COUNT > 0
 
 /**
  * Calc min & max temp of all heaters
@@ -368,49 +531,41 @@ bool Temperature::heaters_isActive() {
 
 #if HAS_MAX31855 || HAS_MAX6675
 
+  /**
+   * Read one thermocouple for call, the heaters are scanned in turn.
+   * Every sensor is read once every SPI_SENSOR_INTERVAL and the idle
+   * loop never waits for more than one SPI transaction.
+   */
   void Temperature::getTemperature_SPI() {
 
+    static millis_s next_spi_ms = 0;
+    static uint8_t  spi_index   = 0;
+
+    if (pending(&next_spi_ms, millis_s((SPI_SENSOR_INTERVAL) / (HEATER_COUNT)))) return;
+
+    uint8_t h = spi_index;
+    if (++spi_index >= HEATER_COUNT) spi_index = 0;
+
+    Heater *act = nullptr;
     #if HOTENDS > 0
-      LOOP_HOTEND() {
-        Heater *act = &hotends[h];
-        if (false) {}
-        #if HAS_MAX31855
-          else if (act->data.sensor.type == -4)
-            act->data.sensor.raw = act->data.sensor.read_max31855();
-        #endif
-        #if HAS_MAX6675
-          else if (act->data.sensor.type == -3)
-            act->data.sensor.raw = act->data.sensor.read_max6675();
-        #endif
-      }
+      if (h < HOTENDS) act = &hotends[h]; else h -= HOTENDS;
     #endif
     #if BEDS > 0
-      LOOP_BED() {
-        Heater *act = &beds[h];
-        if (false) {}
-        #if HAS_MAX31855
-          else if (act->data.sensor.type == -4)
-            act->data.sensor.raw = act->data.sensor.read_max31855();
-        #endif
-        #if HAS_MAX6675
-          else if (act->data.sensor.type == -3)
-            act->data.sensor.raw = act->data.sensor.read_max6675();
-        #endif
-      }
+      if (!act) { if (h < BEDS) act = &beds[h]; else h -= BEDS; }
     #endif
     #if CHAMBERS > 0
-      LOOP_CHAMBER() {
-        Heater *act = &chambers[h];
-        if (false) {}
-        #if HAS_MAX31855
-          else if (act->data.sensor.type == -4)
-            act->data.sensor.raw = act->data.sensor.read_max31855();
-        #endif
-        #if HAS_MAX6675
-          else if (act->data.sensor.type == -3)
-            act->data.sensor.raw = act->data.sensor.read_max6675();
-        #endif
-      }
+      if (!act && h < CHAMBERS) act = &chambers[h];
+    #endif
+
+    if (!act) return;
+
+    #if HAS_MAX31855
+      if (act->data.sensor.type == -4)
+        act->data.sensor.raw = act->data.sensor.read_max31855();
+    #endif
+    #if HAS_MAX6675
+      if (act->data.sensor.type == -3)
+        act->data.sensor.raw = act->data.sensor.read_max6675();
     #endif
 
   }
@@ -87,6 +87,21 @@ class Temperature {
      */
     static bool heaters_isActive();
 
+    /**
+     * Wait for all heaters with a target at once,
+     * staggering the power-on within the power budget
+     */
+    #if ENABLED(CONCURRENT_PREHEAT)
+      static void wait_heaters_concurrent();
+    #endif
+
+    /**
+     * Wait for the heaters to be within the window of the target
+     */
+    #if ENABLED(PROBE_SEQUENCE_OPTIMIZATION) && HEATER_COUNT > 0
+      static void wait_heaters_near_target(const int16_t window);
+    #endif
+
     /**
      * Calc min & max temp of all hotends
      */
@@ -145,6 +145,10 @@
       );
     }
 
+  #endif // ABL_BILINEAR_SUBDIVISION
+
+  #if ENABLED(ABL_BILINEAR_SUBDIVISION) || ENABLED(ABL_BICUBIC_INTERPOLATION)
+
     #define LINEAR_EXTRAPOLATION(E, I) ((E) * 2 - (I))
 
     float AutoBedLevel::bed_level_virt_coord(const uint8_t x, const uint8_t y) {
@@ -185,6 +189,10 @@
       return z_values[x - 1][y - 1];
     }
 
+  #endif // ABL_BILINEAR_SUBDIVISION || ABL_BICUBIC_INTERPOLATION
+
+  #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+
     float AutoBedLevel::bed_level_virt_cmr(const float p[4], const uint8_t i, const float t) {
       return (
           p[i-1] * -t * sq(1 - t)
@@ -231,12 +239,58 @@
 
   #endif // ABL_BILINEAR_SUBDIVISION
 
+  #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+
+    float AutoBedLevel::bicubic_coeff[GRID_MAX_POINTS_X - 1][GRID_MAX_POINTS_Y - 1][4][4];
+
+    /**
+     * Precompute the Catmull-Rom coefficients of every cell from
+     * its 4x4 neighborhood. Outside the grid the points are linearly
+     * extrapolated, as for the subdivision.
+     */
+    void AutoBedLevel::bicubic_interpolate() {
+
+      // Catmull-Rom basis matrix (times 2)
+      static const int8_t cmr[4][4] = {
+        {  0,  2,  0,  0 },
+        { -1,  0,  1,  0 },
+        {  2, -5,  4, -1 },
+        { -1,  3, -3,  1 }
+      };
+
+      for (uint8_t x = 0; x < GRID_MAX_POINTS_X - 1; x++) {
+        for (uint8_t y = 0; y < GRID_MAX_POINTS_Y - 1; y++) {
+
+          // Points of the neighborhood, the cell corners are p[1..2][1..2]
+          float p[4][4], m[4][4];
+          for (uint8_t i = 0; i < 4; i++)
+            for (uint8_t j = 0; j < 4; j++)
+              p[i][j] = bed_level_virt_coord(x + i, y + j);
+
+          // Along X
+          for (uint8_t i = 0; i < 4; i++)
+            for (uint8_t j = 0; j < 4; j++)
+              m[i][j] = cmr[i][0] * p[0][j] + cmr[i][1] * p[1][j] + cmr[i][2] * p[2][j] + cmr[i][3] * p[3][j];
+
+          // Along Y
+          for (uint8_t i = 0; i < 4; i++)
+            for (uint8_t j = 0; j < 4; j++)
+              bicubic_coeff[x][y][i][j] = (m[i][0] * cmr[j][0] + m[i][1] * cmr[j][1] + m[i][2] * cmr[j][2] + m[i][3] * cmr[j][3]) * 0.25f;
+
+        }
+      }
+    }
+
+  #endif // ABL_BICUBIC_INTERPOLATION
+
   // Refresh after other values have been updated
   void AutoBedLevel::refresh_bed_level() {
     bilinear_grid_factor[X_AXIS] = RECIPROCAL(bilinear_grid_spacing[X_AXIS]);
     bilinear_grid_factor[Y_AXIS] = RECIPROCAL(bilinear_grid_spacing[Y_AXIS]);
     #if ENABLED(ABL_BILINEAR_SUBDIVISION)
       virt_interpolate();
+    #elif ENABLED(ABL_BICUBIC_INTERPOLATION)
+      bicubic_interpolate();
     #endif
   }
 
@@ -254,9 +308,51 @@
     #define ABL_BG_GRID(X,Y)  z_values[X][Y]
   #endif
 
+  // Cell of the grid used for the leveling, as split by the segmenter
+  int8_t AutoBedLevel::cell_index_x(const float &x) {
+    const int cx = (x - bilinear_start[X_AXIS]) * ABL_BG_FACTOR(X_AXIS);
+    return constrain(cx, 0, ABL_BG_POINTS_X - 2);
+  }
+
+  int8_t AutoBedLevel::cell_index_y(const float &y) {
+    const int cy = (y - bilinear_start[Y_AXIS]) * ABL_BG_FACTOR(Y_AXIS);
+    return constrain(cy, 0, ABL_BG_POINTS_Y - 2);
+  }
+
+  #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+
+    // Z adjustment on the bicubic surface: cell index and cubic evaluation
+    float AutoBedLevel::bicubic_z_offset(const float raw[XYZ]) {
+
+      // XY relative to the probed area, in grid units
+      float tx = (raw[X_AXIS] - bilinear_start[X_AXIS]) * bilinear_grid_factor[X_AXIS],
+            ty = (raw[Y_AXIS] - bilinear_start[Y_AXIS]) * bilinear_grid_factor[Y_AXIS];
+
+      const int8_t  cx = constrain(FLOOR(tx), 0, GRID_MAX_POINTS_X - 2),
+                    cy = constrain(FLOOR(ty), 0, GRID_MAX_POINTS_Y - 2);
+
+      // Ratio within the cell. Outside the grid the edge value is kept.
+      tx = constrain(tx - cx, 0, 1);
+      ty = constrain(ty - cy, 0, 1);
+
+      const float (*a)[4] = bicubic_coeff[cx][cy];
+
+      float offset = 0;
+      for (int8_t i = 3; i >= 0; i--)
+        offset = offset * tx + ((a[i][3] * ty + a[i][2]) * ty + a[i][1]) * ty + a[i][0];
+
+      return offset;
+    }
+
+  #endif // ABL_BICUBIC_INTERPOLATION
+
   // Get the Z adjustment for non-linear bed leveling
   float AutoBedLevel::bilinear_z_offset(const float raw[XYZ]) {
 
+    #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+      return bicubic_z_offset(raw);
+    #endif
+
     static float  z1, d2, z3, d4, L, D, ratio_x, ratio_y,
                   last_x = -999.999, last_y = -999.999;
 
@@ -335,8 +431,90 @@
     return offset;
   }
 
+  /**
+   * Get the Z adjustment scaled by the leveling fade factor.
+   * The factor is premultiplied into the corners of a cell cache of its
+   * own, rebuilt only on a cell change or a layer change (new factor).
+   * Unfaded lookups through bilinear_z_offset don't disturb it.
+   */
+  float AutoBedLevel::faded_z_offset(const float raw[XYZ], const float factor) {
+
+    #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+
+      return bicubic_z_offset(raw) * factor;
+
+    #else
+
+      static float  z1, d2, z3, d4,
+                    last_factor = 0;
+
+      static int8_t last_gridx = -99, last_gridy = -99;
+
+      // XY relative to the probed area, in grid units
+      float ratio_x = (raw[X_AXIS] - bilinear_start[X_AXIS]) * ABL_BG_FACTOR(X_AXIS),
+            ratio_y = (raw[Y_AXIS] - bilinear_start[Y_AXIS]) * ABL_BG_FACTOR(Y_AXIS);
+
+      const int8_t  gridx = constrain(FLOOR(ratio_x), 0, ABL_BG_POINTS_X - 1),
+                    gridy = constrain(FLOOR(ratio_y), 0, ABL_BG_POINTS_Y - 1);
+
+      ratio_x -= gridx; NOLESS(ratio_x, 0);
+      ratio_y -= gridy; NOLESS(ratio_y, 0);
+
+      if (last_gridx != gridx || last_gridy != gridy || last_factor != factor) {
+        last_gridx  = gridx;
+        last_gridy  = gridy;
+        last_factor = factor;
+        const int8_t  nextx = MIN(gridx + 1, ABL_BG_POINTS_X - 1),
+                      nexty = MIN(gridy + 1, ABL_BG_POINTS_Y - 1);
+        // Faded Z at the box corners
+        z1 = ABL_BG_GRID(gridx, gridy) * factor;       // left-front
+        d2 = ABL_BG_GRID(gridx, nexty) * factor - z1;  // left-back (delta)
+        z3 = ABL_BG_GRID(nextx, gridy) * factor;       // right-front
+        d4 = ABL_BG_GRID(nextx, nexty) * factor - z3;  // right-back (delta)
+      }
+
+      const float L = z1 + d2 * ratio_y,
+                  R = z3 + d4 * ratio_y;
+
+      return L + ratio_x * (R - L);
+
+    #endif
+  }
+
   #if !IS_KINEMATIC
 
+    /**
+     * Buffer a move that stays inside one mesh cell.
+     * With bilinear leveling it goes as one block, leveled at both ends.
+     * The bicubic surface is curved inside the cell: split the move
+     * every quarter of a cell so it follows the surface.
+     */
+    static void bilinear_cell_line_to_destination(const float fr_mm_s) {
+
+      #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+
+        const float cell = MIN(abl.bilinear_grid_spacing[X_AXIS], abl.bilinear_grid_spacing[Y_AXIS]);
+        const uint16_t segments = HYPOT(mechanics.destination[X_AXIS] - mechanics.current_position[X_AXIS],
+                                        mechanics.destination[Y_AXIS] - mechanics.current_position[Y_AXIS]) * 4.0f / cell + 1;
+
+        if (segments > 1) {
+          float end[XYZE];
+          COPY_ARRAY(end, mechanics.destination);
+          const float inv_segments = 1.0f / segments;
+          for (uint16_t s = 1; s < segments; s++) {
+            const float t = s * inv_segments;
+            LOOP_XYZE(i) mechanics.destination[i] = mechanics.current_position[i] + (end[i] - mechanics.current_position[i]) * t;
+            mechanics.buffer_line_to_destination(fr_mm_s);
+          }
+          COPY_ARRAY(mechanics.destination, end);
+        }
+
+      #endif
+
+      mechanics.buffer_line_to_destination(fr_mm_s);
+      mechanics.set_current_to_destination();
+    }
+
     /**
      * Prepare a bilinear-leveled linear move on Cartesian,
      * splitting the move where it crosses mesh borders.
@@ -355,8 +533,7 @@
 
       if (cx1 == cx2 && cy1 == cy2) {
         // Start and end on same mesh square
-        mechanics.buffer_line_to_destination(fr_mm_s);
-        mechanics.set_current_to_destination();
+        bilinear_cell_line_to_destination(fr_mm_s);
         return;
       }
 
@@ -386,8 +563,7 @@
       else {
         // Must already have been split on these border(s)
         // This should be a rare case.
-        mechanics.buffer_line_to_destination(fr_mm_s);
-        mechanics.set_current_to_destination();
+        bilinear_cell_line_to_destination(fr_mm_s);
         return;
       }
 
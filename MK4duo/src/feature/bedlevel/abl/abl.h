@@ -37,20 +37,31 @@ class AutoBedLevel {
 
     static float  bilinear_grid_factor[2];
 
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION) || ENABLED(ABL_BICUBIC_INTERPOLATION)
+      #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
+      #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
+    #endif
+
     #if ENABLED(ABL_BILINEAR_SUBDIVISION)
       #define ABL_GRID_POINTS_VIRT_X (GRID_MAX_POINTS_X - 1) * (BILINEAR_SUBDIVISIONS) + 1
       #define ABL_GRID_POINTS_VIRT_Y (GRID_MAX_POINTS_Y - 1) * (BILINEAR_SUBDIVISIONS) + 1
-      #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
-      #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
 
       static float  bilinear_grid_factor_virt[2],
                     z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
       static int    bilinear_grid_spacing_virt[2];
     #endif
 
+    #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+      // Catmull-Rom coefficients of each cell: z = sum a[i][j] * tx^i * ty^j
+      static float  bicubic_coeff[GRID_MAX_POINTS_X - 1][GRID_MAX_POINTS_Y - 1][4][4];
+    #endif
+
   public: /** Public Function */
 
     static float bilinear_z_offset(const float raw[XYZ]);
+    static float faded_z_offset(const float raw[XYZ], const float factor);
+    static int8_t cell_index_x(const float &x);
+    static int8_t cell_index_y(const float &y);
     static void refresh_bed_level();
 
     /**
@@ -66,6 +77,10 @@ class AutoBedLevel {
       static void virt_interpolate();
     #endif
 
+    #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+      static void bicubic_interpolate();
+    #endif
+
     #if !IS_KINEMATIC
       void bilinear_line_to_destination(float fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
     #endif
@@ -77,8 +92,15 @@ class AutoBedLevel {
      */
     static void extrapolate_one_point(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir);
 
-    #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION) || ENABLED(ABL_BICUBIC_INTERPOLATION)
       static float bed_level_virt_coord(const uint8_t x, const uint8_t y);
+    #endif
+
+    #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+      static float bicubic_z_offset(const float raw[XYZ]);
+    #endif
+
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION)
       static float bed_level_virt_cmr(const float p[4], const uint8_t i, const float t);
       static float bed_level_virt_2cmr(const uint8_t x, const uint8_t y, const float &tx, const float &ty);
     #endif
@@ -48,6 +48,11 @@
           Bedlevel::last_fade_z;
   #endif
 
+  #if ENABLED(ADAPTIVE_MESH_LEVELING)
+    float Bedlevel::print_area_min[2],
+          Bedlevel::print_area_max[2];
+  #endif
+
   #if HAS_LEVELING
 
     /**
@@ -90,7 +95,7 @@
           #elif ENABLED(AUTO_BED_LEVELING_UBL)
             fade_scaling_factor ? fade_scaling_factor * ubl.get_z_correction(rx, ry) : 0.0
           #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
-            fade_scaling_factor ? fade_scaling_factor * abl.bilinear_z_offset(raw) : 0.0
+            fade_scaling_factor ? abl.faded_z_offset(raw, fade_scaling_factor) : 0.0
           #endif
         );
 
@@ -131,13 +136,59 @@
           #elif ENABLED(AUTO_BED_LEVELING_UBL)
             fade_scaling_factor ? fade_scaling_factor * ubl.get_z_correction(raw[X_AXIS], raw[Y_AXIS]) : 0.0
           #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
-            fade_scaling_factor ? fade_scaling_factor * abl.bilinear_z_offset(raw) : 0.0
+            fade_scaling_factor ? abl.faded_z_offset(raw, fade_scaling_factor) : 0.0
           #endif
         );
 
       #endif
     }
 
+    #if HAS_MESH && !IS_KINEMATIC && ENABLED(MESH_SEGMENT_TOLERANCE)
+
+      /**
+       * Check the mesh correction along a move against the straight line
+       * between the corrections at its ends. Sampled every quarter of a cell.
+       * Return 'true' if the move can go to the planner as a single block.
+       * A move inside one cell returns 'false' without sampling: the
+       * segmenter doesn't split it at any cell edge anyway.
+       */
+      bool Bedlevel::correction_is_linear(const float (&start)[XYZE], const float (&end)[XYZE]) {
+
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          if (abl.cell_index_x(start[X_AXIS]) == abl.cell_index_x(end[X_AXIS])
+           && abl.cell_index_y(start[Y_AXIS]) == abl.cell_index_y(end[Y_AXIS])) return false;
+          const float cell = MIN(abl.bilinear_grid_spacing[X_AXIS], abl.bilinear_grid_spacing[Y_AXIS]);
+        #else
+          if (mbl.cell_index_x(start[X_AXIS]) == mbl.cell_index_x(end[X_AXIS])
+           && mbl.cell_index_y(start[Y_AXIS]) == mbl.cell_index_y(end[Y_AXIS])) return false;
+          constexpr float cell = MIN(MESH_X_DIST, MESH_Y_DIST);
+        #endif
+
+        const float dx = end[X_AXIS] - start[X_AXIS],
+                    dy = end[Y_AXIS] - start[Y_AXIS],
+                    dz = end[Z_AXIS] - start[Z_AXIS];
+
+        const uint16_t samples = HYPOT(dx, dy) * 4.0f / cell + 1;
+        if (samples > 32) return false; // Long moves are split at the cell edges anyway
+
+        #define LEVEL_CORRECTION(X,Y,Z) ({ float rx = X, ry = Y, rz = Z; apply_leveling(rx, ry, rz); rz - (Z); })
+
+        const float c_start = LEVEL_CORRECTION(start[X_AXIS], start[Y_AXIS], start[Z_AXIS]),
+                    c_delta = LEVEL_CORRECTION(end[X_AXIS], end[Y_AXIS], end[Z_AXIS]) - c_start,
+                    inv_samples = 1.0f / samples;
+
+        for (uint16_t i = 1; i < samples; i++) {
+          const float t = i * inv_samples,
+                      z = start[Z_AXIS] + dz * t;
+          if (ABS(LEVEL_CORRECTION(start[X_AXIS] + dx * t, start[Y_AXIS] + dy * t, z) - (c_start + c_delta * t)) > (MESH_SEGMENT_TOLERANCE))
+            return false;
+        }
+
+        return true;
+      }
+
+    #endif
+
   #endif // HAS_LEVELING
 
   bool Bedlevel::leveling_is_valid() {
@@ -172,9 +223,10 @@
       planner.synchronize();
 
       #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-        // Force abl.bilinear_z_offset to re-calculate next time
+        // Force abl.bilinear_z_offset and abl.faded_z_offset to re-calculate next time
         const float reset[XYZ] = { -9999.999, -9999.999, 0 };
         (void)abl.bilinear_z_offset(reset);
+        (void)abl.faded_z_offset(reset, 0);
       #endif
 
       if (flag.leveling_active) {      // leveling from on to off
@@ -242,6 +294,24 @@
     #endif
   }
 
+  #if ENABLED(ADAPTIVE_MESH_LEVELING)
+
+    void Bedlevel::set_print_area(const float x1, const float y1, const float x2, const float y2) {
+      print_area_min[X_AXIS] = MIN(x1, x2);
+      print_area_min[Y_AXIS] = MIN(y1, y2);
+      print_area_max[X_AXIS] = MAX(x1, x2);
+      print_area_max[Y_AXIS] = MAX(y1, y2);
+      flag.print_area = true;
+      if (printer.debugFeature()) {
+        DEBUG_MV("Print area X", print_area_min[X_AXIS]);
+        DEBUG_MV(":", print_area_max[X_AXIS]);
+        DEBUG_MV(" Y", print_area_min[Y_AXIS]);
+        DEBUG_EMV(":", print_area_max[Y_AXIS]);
+      }
+    }
+
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR) || ENABLED(MESH_BED_LEVELING)
 
     /**
@@ -71,7 +71,7 @@ union flaglevel_t {
     bool  leveling_active : 1;
     bool  g26_debug       : 1;
     bool  g29_in_progress : 1;
-    bool  bit3            : 1;
+    bool  print_area      : 1;
     bool  bit4            : 1;
     bool  bit5            : 1;
     bool  bit6            : 1;
@@ -101,6 +101,11 @@ class Bedlevel {
       static float z_fade_height, inverse_z_fade_height;
     #endif
 
+    #if ENABLED(ADAPTIVE_MESH_LEVELING)
+      static float print_area_min[2],   // XY bounding box of the job
+                   print_area_max[2];
+    #endif
+
   private: /** Private Parameters */
 
     #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
@@ -119,6 +124,10 @@ class Bedlevel {
 
     static void unapply_leveling(float raw[XYZ]);
 
+    #if HAS_MESH && !IS_KINEMATIC && ENABLED(MESH_SEGMENT_TOLERANCE)
+      static bool correction_is_linear(const float (&start)[XYZE], const float (&end)[XYZE]);
+    #endif
+
     static bool leveling_is_valid();
     static void set_bed_leveling_enabled(const bool enable=true);
     static void reset();
@@ -173,6 +182,14 @@ class Bedlevel {
 
     #endif
 
+    #if ENABLED(ADAPTIVE_MESH_LEVELING)
+      /**
+       * Set the XY bounding box of the job for G29 U
+       */
+      static void set_print_area(const float x1, const float y1, const float x2, const float y2);
+      FORCE_INLINE static void clear_print_area() { flag.print_area = false; }
+    #endif
+
     #if ENABLED(MESH_BED_LEVELING) || ENABLED(PROBE_MANUALLY)
       /**
        * Manual goto xy for Mesh Bed level or Probe Manually
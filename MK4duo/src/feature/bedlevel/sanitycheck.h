@@ -67,6 +67,51 @@ static_assert(1 >= 0
   #if ENABLED(MESH_EDIT_GFX_OVERLAY) && !HAS_GRAPHICAL_LCD
     #error "DEPENDENCY ERROR: MESH_EDIT_GFX_OVERLAY requires a DOGLCD."
   #endif
+  #if UBL_MESH_SD_SLOTS > 0
+    #if DISABLED(UBL_COMPACT_MESH)
+      #error "DEPENDENCY ERROR: UBL_MESH_SD_SLOTS requires UBL_COMPACT_MESH."
+    #elif DISABLED(SDSUPPORT)
+      #error "DEPENDENCY ERROR: UBL_MESH_SD_SLOTS requires SDSUPPORT."
+    #elif UBL_MESH_SD_SLOTS > 100
+      #error "DEPENDENCY ERROR: UBL_MESH_SD_SLOTS must be 100 or less."
+    #endif
+  #endif
+#endif
+
+/**
+ * Adaptive Mesh
+ */
+#if ENABLED(ADAPTIVE_MESH_LEVELING)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "DEPENDENCY ERROR: ADAPTIVE_MESH_LEVELING requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "DEPENDENCY ERROR: ADAPTIVE_MESH_LEVELING does not support PROBE_MANUALLY."
+  #elif DISABLED(ADAPTIVE_MESH_MARGIN)
+    #error "DEPENDENCY ERROR: Missing setting ADAPTIVE_MESH_MARGIN."
+  #endif
+#endif
+
+/**
+ * Bicubic interpolation
+ */
+#if ENABLED(ABL_BICUBIC_INTERPOLATION)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "DEPENDENCY ERROR: ABL_BICUBIC_INTERPOLATION requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(ABL_BILINEAR_SUBDIVISION)
+    #error "DEPENDENCY ERROR: ABL_BICUBIC_INTERPOLATION and ABL_BILINEAR_SUBDIVISION are incompatible. Enable only one."
+  #endif
+#endif
+
+/**
+ * Mesh segment tolerance
+ */
+#if ENABLED(MESH_SEGMENT_TOLERANCE)
+  #if DISABLED(MESH_BED_LEVELING) && DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "DEPENDENCY ERROR: MESH_SEGMENT_TOLERANCE requires MESH_BED_LEVELING or AUTO_BED_LEVELING_BILINEAR."
+  #elif IS_KINEMATIC
+    #error "DEPENDENCY ERROR: MESH_SEGMENT_TOLERANCE is only for Cartesian and Core machines."
+  #endif
+  static_assert(MESH_SEGMENT_TOLERANCE > 0, "DEPENDENCY ERROR: MESH_SEGMENT_TOLERANCE must be greater than 0.");
 #endif
 
 /**
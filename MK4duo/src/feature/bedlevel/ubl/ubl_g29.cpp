@@ -681,6 +681,7 @@
     /**
      * Probe all invalidated locations of the mesh that can be reached by the probe.
      * This attempts to fill in locations closest to the nozzle's start location first.
+     * With PROBE_SEQUENCE_OPTIMIZATION the next location is the closest to the last one probed.
      */
     void unified_bed_leveling::probe_entire_mesh(const float &rx, const float &ry, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) {
       mesh_index_pair location;
@@ -689,6 +690,13 @@
         lcdui.capture();
       #endif
 
+      #if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+        #if HEATER_COUNT > 0
+          thermalManager.wait_heaters_near_target(PROBE_HEATING_WINDOW);
+        #endif
+        probe.begin_sequence();
+      #endif
+
       save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
       DEPLOY_PROBE();
 
@@ -712,8 +720,14 @@
 
         if (do_furthest)
           location = find_furthest_invalid_mesh_point();
-        else
-          location = find_closest_mesh_point_of_type(INVALID, rx, ry, USE_PROBE_AS_REFERENCE, NULL);
+        else {
+          #if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+            // Walk to the nearest unprobed point from the last one probed
+            location = find_closest_mesh_point_of_type(INVALID, mechanics.current_position[X_AXIS], mechanics.current_position[Y_AXIS], USE_PROBE_AS_REFERENCE, NULL);
+          #else
+            location = find_closest_mesh_point_of_type(INVALID, rx, ry, USE_PROBE_AS_REFERENCE, NULL);
+          #endif
+        }
 
         if (location.x_index >= 0) {    // mesh point found and is reachable by probe
           const float rawx = mesh_index_to_xpos(location.x_index),
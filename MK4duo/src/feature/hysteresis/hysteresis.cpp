@@ -27,16 +27,32 @@
 Hysteresis hysteresis;
 
 /** Public Parameters */
-float Hysteresis::mm[XYZ]     = { 0.0 },
-      Hysteresis::correction  = 0.0;
+float Hysteresis::mm[XYZ]           = { 0.0 },
+      Hysteresis::smoothing_mm[XYZ] = { 0.0 },
+      Hysteresis::correction        = 0.0;
+
+/** Private Parameters */
+int32_t Hysteresis::residual_steps[XYZ] = { 0 };
 
 /** Public Function */
 void Hysteresis::factory_parameters() {
-  static const float tmp[] PROGMEM = HYSTERESIS_AXIS_MM;
-  LOOP_XYZ(i) mm[i] = pgm_read_float(&tmp[i]);
+  static const float tmp[]     PROGMEM = HYSTERESIS_AXIS_MM,
+                     tmp_smo[] PROGMEM = HYSTERESIS_SMOOTHING_MM;
+  LOOP_XYZ(i) {
+    mm[i]           = pgm_read_float(&tmp[i]);
+    smoothing_mm[i] = pgm_read_float(&tmp_smo[i]);
+  }
   correction  = HYSTERESIS_CORRECTION;
 }
 
+/**
+ * The steps still to take up are kept signed per axis, so a
+ * reversal before the previous correction is done only takes
+ * back what was really added.
+ * With a smoothing distance the correction is added at a fixed
+ * rate of mm / smoothing_mm extra steps per axis step, on the
+ * blocks that move the axis the same way as the correction.
+ */
 void Hysteresis::add_correction_step(block_t * const block) {
 
   static uint8_t last_direction_bits = 0;
@@ -47,16 +63,27 @@ void Hysteresis::add_correction_step(block_t * const block) {
 
   last_direction_bits ^= direction_change_bits;
 
-  if (correction == 0.0f || !direction_change_bits) return;
-
   LOOP_XYZ(axis) {
-    if (mm[axis]) {
-      // When an axis changes direction, add axis hysteresis
-      if (TEST(direction_change_bits, axis)) {
-        const uint32_t fix = correction * mm[axis] * mechanics.data.axis_steps_per_mm[axis];
-        block->steps[axis] += fix;
-      }
+
+    // When an axis changes direction, add axis hysteresis
+    if (correction && mm[axis] && TEST(direction_change_bits, axis)) {
+      const int32_t fix = correction * mm[axis] * mechanics.data.axis_steps_per_mm[axis];
+      residual_steps[axis] += TEST(block->direction_bits, axis) ? -fix : fix;
     }
+
+    // Only take up steps while moving the same way as the correction
+    if (!residual_steps[axis] || !block->steps[axis] || TEST(block->direction_bits, axis) != (residual_steps[axis] < 0))
+      continue;
+
+    uint32_t fix = ABS(residual_steps[axis]);
+    if (smoothing_mm[axis] > 0) {
+      uint32_t rate_steps = CEIL(block->steps[axis] * correction * mm[axis] / smoothing_mm[axis]);
+      NOLESS(rate_steps, 1U);
+      NOMORE(fix, rate_steps);
+    }
+
+    block->steps[axis] += fix;
+    residual_steps[axis] += residual_steps[axis] < 0 ? int32_t(fix) : -int32_t(fix);
   }
 }
 
@@ -66,6 +93,9 @@ void Hysteresis::print_M99() {
   SERIAL_MV(" Y", mm[Y_AXIS]);
   SERIAL_MV(" Z", mm[Z_AXIS]);
   SERIAL_MV(" F", correction);
+  SERIAL_MV(" I", smoothing_mm[X_AXIS]);
+  SERIAL_MV(" J", smoothing_mm[Y_AXIS]);
+  SERIAL_MV(" K", smoothing_mm[Z_AXIS]);
   SERIAL_EOL();
 }
 
@@ -32,8 +32,13 @@ class Hysteresis {
   public: /** Public Parameters */
 
     static float  mm[XYZ],
+                  smoothing_mm[XYZ],
                   correction;
 
+  private: /** Private Parameters */
+
+    static int32_t residual_steps[XYZ];
+
   public: /** Public Function */
 
     static void factory_parameters();
@@ -0,0 +1,134 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../MK4duo.h"
+
+#if ENABLED(HEATERS_POWER_ARBITER)
+
+PowerArbiter powerArbiter;
+
+/** Public Parameters */
+uint16_t PowerArbiter::budget       = HEATERS_POWER_BUDGET;
+
+/** Private Parameters */
+uint16_t PowerArbiter::requested    = 0,
+         PowerArbiter::granted      = 0;
+uint32_t PowerArbiter::saturated_ms = 0;
+millis_l PowerArbiter::last_ms      = 0;
+
+/** Public Function */
+void PowerArbiter::spin() {
+
+  Heater  *list[HEATER_COUNT];
+  float   demand[HEATER_COUNT],
+          weight[HEATER_COUNT];
+  bool    done[HEATER_COUNT];
+  uint8_t count = 0;
+  float   total = 0;
+
+  const millis_l now = millis(),
+                 elapsed = now - last_ms;
+  last_ms = now;
+
+  // Demand in Watt and weight of each heater on
+  #define ADD_HEATER(H, PRIORITY) do{ \
+    const uint16_t watts = H.get_watts(); \
+    if (H.pwm_value && watts) { \
+      const float error = (H.isIdle() ? H.idle_temperature : H.target_temperature) - H.current_temperature; \
+      list[count]   = &H; \
+      demand[count] = watts * H.pwm_value * (1.0f / 255.0f); \
+      weight[count] = (PRIORITY) * MAX(error, 1.0f); \
+      done[count]   = false; \
+      total += demand[count]; \
+      count++; \
+    } \
+  }while(0)
+
+  #if HOTENDS > 0
+    LOOP_HOTEND() ADD_HEATER(hotends[h], HOTEND_POWER_PRIORITY);
+  #endif
+  #if BEDS > 0
+    LOOP_BED() ADD_HEATER(beds[h], BED_POWER_PRIORITY);
+  #endif
+  #if CHAMBERS > 0
+    LOOP_CHAMBER() ADD_HEATER(chambers[h], CHAMBER_POWER_PRIORITY);
+  #endif
+
+  #undef ADD_HEATER
+
+  requested = total;
+
+  if (total <= budget) {
+    granted = total;
+    return;
+  }
+
+  saturated_ms += elapsed;
+
+  // The heaters that ask less than their share get all they ask,
+  // repeat until the share of all the others is lower than their demand
+  float   left    = budget,
+          wsum    = 0;
+  uint8_t pending = count;
+  for (bool again = true; again && pending;) {
+    again = false;
+    wsum = 0;
+    for (uint8_t i = 0; i < count; i++) if (!done[i]) wsum += weight[i];
+    for (uint8_t i = 0; i < count; i++) {
+      if (!done[i] && demand[i] <= left * weight[i] / wsum) {
+        left -= demand[i];
+        done[i] = true;
+        pending--;
+        again = true;
+      }
+    }
+  }
+
+  // Divide what is left by weight
+  if (pending) {
+    wsum = 0;
+    for (uint8_t i = 0; i < count; i++) if (!done[i]) wsum += weight[i];
+    for (uint8_t i = 0; i < count; i++) {
+      if (done[i]) continue;
+      Heater * const act = list[i];
+      act->limit_output((left * weight[i] / wsum) * 255.0f / act->get_watts());
+    }
+  }
+
+  granted = budget;
+
+}
+
+void PowerArbiter::reset() {
+  CRITICAL_SECTION_START
+  saturated_ms = 0;
+  CRITICAL_SECTION_END
+}
+
+void PowerArbiter::report() {
+  SERIAL_SMV(ECHO, "Heaters power budget:", budget);
+  SERIAL_MV("W requested:", requested);
+  SERIAL_MV("W granted:", granted);
+  SERIAL_EMV("W saturated time (s):", saturated_ms * 0.001f, 1);
+}
+
+#endif // ENABLED(HEATERS_POWER_ARBITER)
@@ -0,0 +1,74 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * powerarbiter.h - heaters power arbiter
+ *
+ * Limit the total power of hotends, beds and chambers to the PSU budget.
+ * When the heaters ask for more than the budget, the power is divided by
+ * priority and by the error of each heater from its target.
+ */
+
+#if ENABLED(HEATERS_POWER_ARBITER)
+
+class PowerArbiter {
+
+  public: /** Constructor */
+
+    PowerArbiter() {};
+
+  public: /** Public Parameters */
+
+    static uint16_t budget;         // Max power for all heaters (W)
+
+  private: /** Private Parameters */
+
+    static uint16_t requested,      // Power asked by the heaters in the last cycle (W)
+                    granted;        // Power given to the heaters in the last cycle (W)
+
+    static uint32_t saturated_ms;   // Time spent over the budget
+
+    static millis_l last_ms;
+
+  public: /** Public Function */
+
+    /**
+     * Called from the Temperature ISR after the heaters output
+     */
+    static void spin();
+
+    /**
+     * Reset the saturation time
+     */
+    static void reset();
+
+    /**
+     * Print budget, power and saturation time
+     */
+    static void report();
+
+};
+
+extern PowerArbiter powerArbiter;
+
+#endif // ENABLED(HEATERS_POWER_ARBITER)
@@ -33,6 +33,12 @@ Probe probe;
 /** Public Parameters */
 probe_data_t Probe::data;
 
+/** Private Parameters */
+#if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+  float Probe::z_seen_min = 99999.9f,
+        Probe::z_seen_max = -99999.9f;
+#endif
+
 /** Public Function */
 void Probe::factory_parameters() {
   data.offset[X_AXIS] = X_PROBE_OFFSET_FROM_NOZZLE;
@@ -183,8 +189,14 @@ bool Probe::set_deployed(const bool deploy) {
       if (!set_deployed(true)) {
         measured_z = run_probing() + data.offset[Z_AXIS];
 
-        if (raise_after == PROBE_PT_RAISE)
-          mechanics.do_blocking_move_to_z(mechanics.current_position[Z_AXIS] + Z_PROBE_BETWEEN_HEIGHT, MMM_TO_MMS(data.speed_fast));
+        if (raise_after == PROBE_PT_RAISE) {
+          #if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+            const float z_raise = between_height(measured_z);
+          #else
+            constexpr float z_raise = Z_PROBE_BETWEEN_HEIGHT;
+          #endif
+          mechanics.do_blocking_move_to_z(mechanics.current_position[Z_AXIS] + z_raise, MMM_TO_MMS(data.speed_fast));
+        }
         else if (raise_after == PROBE_PT_STOW)
           if (set_deployed(false)) measured_z = NAN;
       }
@@ -563,6 +575,24 @@ float Probe::run_probing() {
   return probe_z / (float)data.repetitions;
 }
 
+#if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+
+  /**
+   * Raise to travel to the next point: the bed deviation measured
+   * so far in this sequence plus the margin, never more than
+   * Z_PROBE_BETWEEN_HEIGHT. Until two different heights are known
+   * the full Z_PROBE_BETWEEN_HEIGHT is used.
+   */
+  float Probe::between_height(const float measured_z) {
+    if (isnan(measured_z)) return Z_PROBE_BETWEEN_HEIGHT;
+    NOMORE(z_seen_min, measured_z);
+    NOLESS(z_seen_max, measured_z);
+    if (z_seen_max <= z_seen_min) return Z_PROBE_BETWEEN_HEIGHT;
+    return MIN(z_seen_max - z_seen_min + (PROBE_RAISE_MARGIN), Z_PROBE_BETWEEN_HEIGHT);
+  }
+
+#endif
+
 #if ENABLED(Z_PROBE_ALLEN_KEY)
 
   void Probe::run_deploy_moves_script() {
@@ -58,6 +58,13 @@ class Probe {
 
     static probe_data_t data;
 
+  private: /** Private Parameters */
+
+    #if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+      static float  z_seen_min,
+                    z_seen_max;
+    #endif
+
   public: /** Public Function */
 
     /**
@@ -85,6 +92,13 @@ class Probe {
        */
       static float check_pt(const float &rx, const float &ry, const ProbePtRaiseEnum raise_after=PROBE_PT_NONE, const uint8_t verbose_level=0, const bool probe_relative=true);
 
+      /**
+       * Start a new probe sequence, forget the measured bed deviation
+       */
+      #if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+        static void begin_sequence() { z_seen_min = 99999.9f; z_seen_max = -99999.9f; }
+      #endif
+
     #endif
 
     #if QUIET_PROBING
@@ -103,6 +117,10 @@ class Probe {
 
     static float run_probing();
 
+    #if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+      static float between_height(const float measured_z);
+    #endif
+
     #if ENABLED(Z_PROBE_ALLEN_KEY)
       static void run_deploy_moves_script();
       static void run_stow_moves_script();
@@ -124,3 +124,18 @@
     #error "DEPENDENCY ERROR: G38_PROBE_TARGET requires a Cartesian or Core machine."
   #endif
 #endif
+
+// Probe sequence optimization
+#if ENABLED(PROBE_SEQUENCE_OPTIMIZATION)
+  #if !HAS_BED_PROBE
+    #error "DEPENDENCY ERROR: PROBE_SEQUENCE_OPTIMIZATION requires a bed probe."
+  #elif ENABLED(PROBING_HEATERS_OFF)
+    #error "DEPENDENCY ERROR: PROBE_SEQUENCE_OPTIMIZATION is incompatible with PROBING_HEATERS_OFF."
+  #elif DISABLED(PROBE_RAISE_MARGIN) || DISABLED(PROBE_HEATING_WINDOW)
+    #error "DEPENDENCY ERROR: PROBE_SEQUENCE_OPTIMIZATION requires PROBE_RAISE_MARGIN and PROBE_HEATING_WINDOW."
+  #elif PROBE_RAISE_MARGIN <= 0 || PROBE_RAISE_MARGIN > Z_PROBE_BETWEEN_HEIGHT
+    #error "DEPENDENCY ERROR: PROBE_RAISE_MARGIN must be greater than 0 and not more than Z_PROBE_BETWEEN_HEIGHT."
+  #elif PROBE_HEATING_WINDOW < 0
+    #error "DEPENDENCY ERROR: PROBE_HEATING_WINDOW must be 0 or greater."
+  #endif
+#endif
@@ -26,6 +26,10 @@
 
 Restart restart;
 
+// Journal starts on the block after the snapshot
+constexpr uint32_t  restart_journal_pos = (sizeof(restart_job_t) + 511) & ~511UL,
+                    restart_file_size   = restart_journal_pos + uint32_t(SD_RESTART_JOURNAL_RECORDS) * sizeof(restart_record_t);
+
 /** Public Parameters */
 SdFile Restart::job_file;
 
@@ -33,8 +37,16 @@ restart_job_t Restart::job_info;
 
 bool Restart::enabled;
 
+uint32_t Restart::cmd_sdpos = 0;
+
+/** Private Parameters */
+uint32_t Restart::journal_seq = 0;
+
 /** Public Function */
-void Restart::init_job() { memset(&job_info, 0, sizeof(job_info)); }
+void Restart::init_job() {
+  memset(&job_info, 0, sizeof(job_info));
+  cmd_sdpos = journal_seq = 0;
+}
 
 void Restart::enable(const bool onoff) {
   enabled = onoff;
@@ -68,6 +80,23 @@ void Restart::load_job() {
   if (exists()) {
     open(true);
     (void)job_file.read(&job_info, sizeof(job_info));
+    journal_seq = 0;
+
+    // Replay the newest valid journal record over the snapshot
+    if (valid() && job_file.seekSet(restart_journal_pos)) {
+      restart_record_t record, last;
+      for (uint16_t r = 0; r < SD_RESTART_JOURNAL_RECORDS; r++) {
+        if (job_file.read(&record, sizeof(record)) != int(sizeof(record))) break;
+        if (record.job_id != job_info.job_id || record.seq <= journal_seq) continue;
+        uint16_t crc = 0;
+        crc16(&crc, &record, offsetof(restart_record_t, crc));
+        if (crc != record.crc) continue;
+        journal_seq = record.seq;
+        last = record;
+      }
+      if (journal_seq) record_job(last, true);
+    }
+
     close();
   }
   debug_info(PSTR("Load"));
@@ -85,9 +114,6 @@ void Restart::save_job(const bool force_save/*=false*/, const bool save_count/*=
       || mechanics.current_position[Z_AXIS] > job_info.current_position[Z_AXIS]
   ) {
 
-    if (!++job_info.valid_head) ++job_info.valid_head; // non-zero in sequence
-    job_info.valid_foot = job_info.valid_head;
-
     // Mechanics state
     COPY_ARRAY(job_info.current_position, mechanics.current_position);
     #if ENABLED(WORKSPACE_OFFSETS)
@@ -138,26 +164,21 @@ void Restart::save_job(const bool force_save/*=false*/, const bool save_count/*=
     job_info.relative_mode = printer.isRelativeMode();
     job_info.relative_modes_e = printer.axis_relative_modes[E_AXIS];
 
-    // Commands in the queue
-    job_info.buffer_head = commands.buffer_ring.head();
-    job_info.buffer_count = save_count ? commands.buffer_ring.count() : 0;
-    for (uint8_t index = 0; index < BUFSIZE; index++) {
-      gcode_t temp_cmd;
-      temp_cmd = commands.buffer_ring.peek(index);
-      strncpy(job_info.buffer_ring[index], temp_cmd.gcode, sizeof(job_info.buffer_ring[index]) - 1);
-    }
-
     // Elapsed print job time
     job_info.print_job_counter_elapsed = print_job_counter.duration();
 
-    // SD file e position
+    // SD file e position. Resume from the first command not yet run,
+    // or after the queued ones if they are dropped.
+    job_info.sdpos = save_count && cmd_sdpos ? cmd_sdpos : card.getIndex();
+
+    // A new job starts a new journal
     if (!job_info.just_restart) {
       card.getAbsFilename(job_info.fileName);
       job_info.just_restart = true;
+      compact_job();
     }
-    job_info.sdpos = card.getIndex();
-
-    write_job();
+    else
+      write_job();
   }
 }
 
@@ -282,11 +303,6 @@ void Restart::resume_job() {
     }
   #endif
 
-  // Process commands from the old pending queue
-  uint8_t h = job_info.buffer_head, c = job_info.buffer_count;
-  for (; c--; h = (h + 1) % BUFSIZE)
-    commands.process_now(job_info.buffer_ring[h]);
-
   // Resume the SD file from the last position
   char *fn = job_info.fileName;
   while (*fn == '/') fn++;
@@ -298,20 +314,95 @@ void Restart::resume_job() {
 }
 
 /** Private Function */
+
+/**
+ * Append a record to the journal. Records are written in place
+ * inside the preallocated file, so the directory is never updated.
+ */
 void Restart::write_job() {
-  bool failed = false;
 
   debug_info(PSTR("Write"));
 
   open(false);
-  if (!job_file.seekSet(0)) failed = true;
-  if (!failed && !job_file.write(&job_info, sizeof(job_info)) == sizeof(job_info))
-    failed = true;
+
+  // Missing or foreign file, start a new journal
+  if (job_file.fileSize() != restart_file_size) {
+    close();
+    return compact_job();
+  }
+
+  restart_record_t record;
+  memset(&record, 0, sizeof(record));
+  record.seq    = ++journal_seq;
+  record.job_id = job_info.job_id;
+  record_job(record, false);
+  crc16(&record.crc, &record, offsetof(restart_record_t, crc));
+
+  const uint32_t pos = restart_journal_pos + ((record.seq - 1) % SD_RESTART_JOURNAL_RECORDS) * sizeof(record);
+  const bool failed = !job_file.seekSet(pos) || job_file.write(&record, sizeof(record)) != int(sizeof(record));
   close();
   if (failed) DEBUG_LM(DEB, " Restart file write failed.");
 
 }
 
+/**
+ * Write the job snapshot into a new contiguous restart
+ * file and start the journal after it.
+ */
+void Restart::compact_job() {
+
+  if (!++job_info.valid_head) ++job_info.valid_head; // non-zero in sequence
+  job_info.valid_foot = job_info.valid_head;
+
+  // Records left in the reused clusters must not match
+  const uint16_t old_id = job_info.job_id;
+  job_info.job_id = uint16_t(millis()) | 1;
+  if (job_info.job_id == old_id) job_info.job_id += 2;
+
+  journal_seq = 0;
+
+  debug_info(PSTR("Compact"));
+
+  card.delete_restart_file();
+  bool failed = !card.create_restart_file(restart_file_size);
+  if (!failed) failed = job_file.write(&job_info, sizeof(job_info)) != int(sizeof(job_info));
+  close();
+  if (failed) DEBUG_LM(DEB, " Restart file write failed.");
+
+}
+
+/**
+ * Copy the journaled fields between the job and a record
+ */
+void Restart::record_job(restart_record_t &record, const bool load) {
+
+  #define RECORD_FIELD(F) do{ if (load) memcpy(&job_info.F, &record.F, sizeof(record.F)); else memcpy(&record.F, &job_info.F, sizeof(record.F)); }while(0)
+
+  RECORD_FIELD(sdpos);
+  RECORD_FIELD(current_position);
+  RECORD_FIELD(feedrate);
+  #if HOTENDS > 0
+    RECORD_FIELD(target_temperature);
+  #endif
+  #if BEDS > 0
+    RECORD_FIELD(bed_target_temperature);
+  #endif
+  #if CHAMBERS > 0
+    RECORD_FIELD(chamber_target_temperature);
+  #endif
+  #if FAN_COUNT > 0
+    RECORD_FIELD(fan_speed);
+  #endif
+  #if EXTRUDERS > 1
+    RECORD_FIELD(active_extruder);
+  #endif
+  RECORD_FIELD(relative_mode);
+  RECORD_FIELD(relative_modes_e);
+  RECORD_FIELD(print_job_counter_elapsed);
+
+  #undef RECORD_FIELD
+}
+
 #if ENABLED(DEBUG_RESTART)
 
   void Restart::debug_info(PGM_P const prefix) {
@@ -333,9 +424,8 @@ void Restart::write_job() {
           SERIAL_EMV("leveling: ", int(job_info.leveling));
           SERIAL_EMV(" z_fade_height: ", int(job_info.z_fade_height));
         #endif
-        SERIAL_EMV("buffer_head: ", job_info.buffer_head);
-        SERIAL_EMV("buffer_count: ", job_info.buffer_count);
-        for (uint8_t i = 0; i < job_info.buffer_count; i++) SERIAL_EMT("> ", job_info.buffer_ring[i]);
+        SERIAL_MV("job_id: ", job_info.job_id);
+        SERIAL_EMV(" journal_seq: ", journal_seq);
         SERIAL_EMT("Filename: ", job_info.fileName);
         SERIAL_EMV("sdpos: ", job_info.sdpos);
         SERIAL_EMV("print_job_counter_elapsed: ", job_info.print_job_counter_elapsed);
@@ -33,9 +33,18 @@
   #include "../mixing/mixing.h"
 #endif
 
+/**
+ * The restart file holds a snapshot of the job, written when the job
+ * starts, followed by a preallocated journal of small records.
+ * Each save writes one record in the journal ring and loading replays
+ * the valid record with the highest sequence number over the snapshot.
+ */
 typedef struct {
   uint8_t valid_head;
 
+  // Journal records with another id are left over from an older job
+  uint16_t job_id;
+
   // SD file e position
   char fileName[MAX_PATH_NAME_LENGHT];
   uint32_t sdpos;
@@ -83,10 +92,6 @@ typedef struct {
   // Relative mode
   bool relative_mode, relative_modes_e;
 
-  // Command buffer
-  uint8_t buffer_head, buffer_count;
-  char    buffer_ring[BUFSIZE][MAX_CMD_SIZE];
-
   // Job elapsed time
   millis_l print_job_counter_elapsed;
 
@@ -97,6 +102,39 @@ typedef struct {
 
 } restart_job_t;
 
+typedef struct {
+  uint32_t  seq;
+  uint16_t  job_id;
+
+  uint32_t  sdpos;
+  float     current_position[XYZE];
+  uint16_t  feedrate;
+
+  #if HOTENDS > 0
+    int16_t target_temperature[HOTENDS];
+  #endif
+  #if BEDS > 0
+    int16_t bed_target_temperature[BEDS];
+  #endif
+  #if CHAMBERS > 0
+    int16_t chamber_target_temperature[CHAMBERS];
+  #endif
+
+  #if FAN_COUNT > 0
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if EXTRUDERS > 1
+    uint8_t active_extruder;
+  #endif
+
+  bool      relative_mode, relative_modes_e;
+  millis_l  print_job_counter_elapsed;
+
+  uint16_t  crc;
+
+} restart_record_t;
+
 class Restart {
 
   public: /** Constructor */
@@ -111,6 +149,8 @@ class Restart {
 
     static bool enabled;
 
+    static uint32_t cmd_sdpos;  // SD file position after the last SD command run
+
   public: /** Public Function */
 
     static void init_job();
@@ -131,9 +171,15 @@ class Restart {
 
     static inline bool valid() { return job_info.valid_head && job_info.valid_head == job_info.valid_foot; }
 
+  private: /** Private Parameters */
+
+    static uint32_t journal_seq;
+
   private: /** Private Function */
 
     static void write_job();
+    static void compact_job();
+    static void record_job(restart_record_t &record, const bool load);
 
     #if ENABLED(DEBUG_RESTART)
       static void debug_info(PGM_P const prefix);
@@ -29,4 +29,12 @@
 #ifndef _RESTART_SANITYCHECK_H_
 #define _RESTART_SANITYCHECK_H_
 
+#if HAS_SD_RESTART
+  #if DISABLED(SD_RESTART_JOURNAL_RECORDS)
+    #error "DEPENDENCY ERROR: Missing setting SD_RESTART_JOURNAL_RECORDS."
+  #elif SD_RESTART_JOURNAL_RECORDS < 2
+    #error "DEPENDENCY ERROR: SD_RESTART_JOURNAL_RECORDS must be 2 or more."
+  #endif
+#endif
+
 #endif /* _RESTART_SANITYCHECK_H_ */
@@ -651,13 +651,15 @@
   #undef SDSORT_USES_STACK
   #undef SDSORT_CACHE_NAMES
   #undef SDSORT_DYNAMIC_RAM
+  #undef SDSORT_POOL_SIZE
   #define SDCARD_SORT_ALPHA
   #define SDSORT_LIMIT 256
   #define SDSORT_GCODE true
-  #define SDSORT_USES_RAM false
+  #define SDSORT_USES_RAM true
   #define SDSORT_USES_STACK false
-  #define SDSORT_CACHE_NAMES false
-  #define SDSORT_DYNAMIC_RAM false
+  #define SDSORT_CACHE_NAMES true
+  #define SDSORT_DYNAMIC_RAM true
+  #define SDSORT_POOL_SIZE 8192
 #endif
 #if ENABLED(SDCARD_SORT_ALPHA)
   #define HAS_FOLDER_SORTING  (FOLDER_SORTING || ENABLED(SDSORT_GCODE))
@@ -907,6 +909,8 @@
 
 #define HEATER_COUNT  (HOTENDS+BEDS+CHAMBERS+COOLERS)
 
+#define HAS_HEATER_WATTS  (ENABLED(CONCURRENT_PREHEAT) || ENABLED(HEATERS_POWER_ARBITER))
+
 /**
  * FANS
  */
@@ -245,7 +245,8 @@ enum CfgSDEnum : uint8_t {   // This need to be in the same order as cfgSD_KEY
 
 enum LsActionEnum : uint8_t {
   LS_Count,
-  LS_GetFilename
+  LS_GetFilename,
+  LS_SortNames
 };
 
 /**
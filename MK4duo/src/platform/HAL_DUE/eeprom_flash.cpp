@@ -131,6 +131,10 @@ static uint8_t  buffer[256] = { 0 },  // The RAM buffer to accumulate writes
                 curPage = 0,          // Current FLASH page inside the group
                 curGroup = 0xFF;      // Current FLASH group
 
+// RAM image of the emulated EEPROM, so reads and the compare before
+// each write do not scan the FLASH pages
+static uint8_t  eeImage[EEPROMSize];
+
 //#define EE_EMU_DEBUG
 #if ENABLED(EE_EMU_DEBUG)
   static void ee_Dump(int page, const void* data) {
@@ -416,172 +420,52 @@ static bool ee_PageErase(uint16_t page) {
 
   return true;
 }
-static uint8_t ee_Read(uint32_t address, bool excludeRAMBuffer=false) {
-
-  uint32_t baddr;
-  uint32_t blen;
+static uint8_t ee_Read(uint32_t address) {
 
   // If we were requested an address outside of the emulated range, fail now
   if (address >= EEPROMSize)
     return false;
 
-  // Check that the value is not contained in the RAM buffer
-  if (!excludeRAMBuffer) {
-    int i = 0;
-    while (i <= (PageSize - 4)) { /* (PageSize - 4) because otherwise, there is not enough room for data and headers */
-
-      // Get the address of the block
-      baddr = buffer[i] | (buffer[i + 1] << 8);
-
-      // Get the length of the block
-      blen = buffer[i + 2];
-
-      // If we reach the end of the list, break loop
-      if (blen == 0xFF)
-        break;
-
-      // Check if data is contained in this block
-      if (address >= baddr &&
-        address < (baddr + blen)) {
-
-        // Yes, it is contained. Return it!
-        return buffer[i + 3 + address - baddr];
-      }
-
-      // As blocks are always sorted, if the starting address of this block is higher
-      // than the address we are looking for, break loop now - We wont find the value
-      // associated to the address
-      if (baddr > address)
-        break;
-
-      // Jump to the next block
-      i += 3 + blen;
-    }
-  }
-
-  // It is NOT on the RAM buffer. It could be stored in FLASH. We are
-  //  ensured on a given FLASH page, address contents are never repeated
-  //  but on different pages, there is no such warranty, so we must go
-  //  backwards from the last written FLASH page to the first one.
-  for (int page = curPage - 1; page >= 0; --page) {
-
-    // Get a pointer to the flash page
-    uint8_t* pflash = (uint8_t*)getFlashStorage(page + curGroup * PagesPerGroup);
-
-    uint16_t i = 0;
-    while (i <= (PageSize - 4)) { /* (PageSize - 4) because otherwise, there is not enough room for data and headers */
-
-      // Get the address of the block
-      baddr = pflash[i] | (pflash[i + 1] << 8);
-
-      // Get the length of the block
-      blen = pflash[i + 2];
-
-      // If we reach the end of the list, break loop
-      if (blen == 0xFF)
-        break;
-
-      // Check if data is contained in this block
-      if (address >= baddr && address < (baddr + blen))
-        return pflash[i + 3 + address - baddr]; // Yes, it is contained. Return it!
-
-      // As blocks are always sorted, if the starting address of this block is higher
-      // than the address we are looking for, break loop now - We wont find the value
-      // associated to the address
-      if (baddr > address) break;
-
-      // Jump to the next block
-      i += 3 + blen;
-    }
-  }
-
-  // If reached here, value is not stored, so return its default value
-  return 0xFF;
+  // The image has the FLASH pages and the RAM buffer applied
+  return eeImage[address];
 }
 
-static uint32_t ee_GetAddrRange(uint32_t address, bool excludeRAMBuffer=false) {
-  uint32_t  baddr,
-            blen,
-            nextAddr = 0xFFFF,
-            nextRange = 0;
-
-  // Check that the value is not contained in the RAM buffer
-  if (!excludeRAMBuffer) {
-    uint16_t i = 0;
-    while (i <= (PageSize - 4)) { /* (PageSize - 4) because otherwise, there is not enough room for data and headers */
-
-      // Get the address of the block
-      baddr = buffer[i] | (buffer[i + 1] << 8);
-
-      // Get the length of the block
-      blen = buffer[i + 2];
-
-      // If we reach the end of the list, break loop
-      if (blen == 0xFF) break;
-
-      // Check if address and address + 1 is contained in this block
-      if (address >= baddr && address < (baddr + blen))
-        return address | ((blen - address + baddr) << 16); // Yes, it is contained. Return it!
-
-      // Otherwise, check if we can use it as a limit
-      if (baddr > address && baddr < nextAddr) {
-        nextAddr = baddr;
-        nextRange = blen;
-      }
-
-      // As blocks are always sorted, if the starting address of this block is higher
-      // than the address we are looking for, break loop now - We wont find the value
-      // associated to the address
-      if (baddr > address) break;
+/**
+ * Build the RAM image replaying the written pages of the current group,
+ * oldest first so the newest value of each address wins.
+ * A page with a block outside the emulated range or the page is not
+ * a valid page and the replay stops there.
+ */
+static void ee_LoadImage() {
 
-      // Jump to the next block
-      i += 3 + blen;
-    }
-  }
+  memset(eeImage, 0xFF, sizeof(eeImage));
 
-  // It is NOT on the RAM buffer. It could be stored in FLASH. We are
-  //  ensured on a given FLASH page, address contents are never repeated
-  //  but on different pages, there is no such warranty, so we must go
-  //  backwards from the last written FLASH page to the first one.
-  for (int page = curPage - 1; page >= 0; --page) {
+  for (int page = 0; page < curPage; ++page) {
 
-    // Get a pointer to the flash page
-    uint8_t* pflash = (uint8_t*)getFlashStorage(page + curGroup * PagesPerGroup);
+    const uint8_t* pflash = (const uint8_t*)getFlashStorage(page + curGroup * PagesPerGroup);
 
     uint16_t i = 0;
     while (i <= (PageSize - 4)) { /* (PageSize - 4) because otherwise, there is not enough room for data and headers */
 
-      // Get the address of the block
-      baddr = pflash[i] | (pflash[i + 1] << 8);
-
-      // Get the length of the block
-      blen = pflash[i + 2];
+      const uint32_t  baddr = pflash[i] | (pflash[i + 1] << 8),
+                      blen  = pflash[i + 2];
 
-      // If we reach the end of the list, break loop
+      // If we reach the end of the list, go to the next page
       if (blen == 0xFF) break;
 
-      // Check if data is contained in this block
-      if (address >= baddr && address < (baddr + blen))
-        return address | ((blen - address + baddr) << 16); // Yes, it is contained. Return it!
-
-      // Otherwise, check if we can use it as a limit
-      if (baddr > address && baddr < nextAddr) {
-        nextAddr = baddr;
-        nextRange = blen;
+      if (baddr + blen > EEPROMSize || i + 3 + blen > PageSize) {
+        #if ENABLED(EE_EMU_DEBUG)
+          SERIAL_LMV(ECHO, "EEPROM Invalid block on page ", page);
+        #endif
+        return;
       }
 
-      // As blocks are always sorted, if the starting address of this block is higher
-      // than the address we are looking for, break loop now - We wont find the value
-      // associated to the address
-      if (baddr > address) break;
+      memcpy(&eeImage[baddr], &pflash[i + 3], blen);
 
       // Jump to the next block
       i += 3 + blen;
     }
   }
-
-  // If reached here, we will return the next valid address
-  return nextAddr | (nextRange << 16);
 }
 
 static bool ee_IsPageClean(int page) {
@@ -633,114 +517,89 @@ static bool ee_Flush(uint32_t overrideAddress=0xFFFFFFFF, uint8_t overrideData=0
     return true;
   }
 
-  // We have no space left on the current group - We must compact the values
+  // We have no space left on the current group - We must compact the values.
+  // The image already holds the override data.
   uint16_t i = 0;
 
   // Compute the next group to use
   int curwPage = 0, curwGroup = curGroup + 1;
   if (curwGroup >= GroupCount) curwGroup = 0;
 
-  uint32_t rdAddr = 0;
-  do {
-
-    // Get the next valid range
-    uint32_t addrRange = ee_GetAddrRange(rdAddr, true);
-
-    // Make sure not to skip the override address, if specified
-    int rdRange;
-    if (overrideAddress < EEPROMSize &&
-      rdAddr <= overrideAddress &&
-      (addrRange & 0xFFFF) > overrideAddress) {
+  for (uint32_t rdAddr = 0; rdAddr < EEPROMSize; ++rdAddr) {
 
-      rdAddr = overrideAddress;
-      rdRange = 1;
-    }
-    else {
-      rdAddr = addrRange & 0xFFFF;
-      rdRange = addrRange >> 16;
-    }
-
-    // If no range, break loop
-    if (rdRange == 0)
-      break;
+    // Get the value
+    const uint8_t rdValue = eeImage[rdAddr];
 
-    do {
+    // Do not bother storing default values
+    if (rdValue == 0xFF) continue;
 
-      // Get the value
-      uint8_t rdValue = overrideAddress == rdAddr ? overrideData : ee_Read(rdAddr, true);
+    // If we have room, add it to the buffer
+    if (buffer[i + 2] == 0xFF) {
 
-      // Do not bother storing default values
-      if (rdValue != 0xFF) {
+      // Uninitialized buffer, just add it!
+      buffer[i] = rdAddr & 0xFF;
+      buffer[i + 1] = (rdAddr >> 8) & 0xFF;
+      buffer[i + 2] = 1;
+      buffer[i + 3] = rdValue;
 
-        // If we have room, add it to the buffer
-        if (buffer[i + 2] == 0xFF) {
-
-          // Uninitialized buffer, just add it!
-          buffer[i] = rdAddr & 0xFF;
-          buffer[i + 1] = (rdAddr >> 8) & 0xFF;
-          buffer[i + 2] = 1;
-          buffer[i + 3] = rdValue;
-
-        }
-        else {
-          // Buffer already has contents. Check if we can extend it
-
-          // Get the address of the block
-          uint32_t baddr = buffer[i] | (buffer[i + 1] << 8);
+    }
+    else {
+      // Buffer already has contents. Check if we can extend it
 
-          // Get the length of the block
-          uint32_t blen = buffer[i + 2];
+      // Get the address of the block
+      uint32_t baddr = buffer[i] | (buffer[i + 1] << 8);
 
-          // Can we expand it ?
-          if (rdAddr == (baddr + blen) &&
-            i < (PageSize - 4) && /* This block has a chance to contain data AND */
-            buffer[i + 2] < (PageSize - i - 3)) {/* There is room for this block to be expanded */
+      // Get the length of the block
+      uint32_t blen = buffer[i + 2];
 
-            // Yes, do it
-            ++buffer[i + 2];
+      // Can we expand it ?
+      if (rdAddr == (baddr + blen) &&
+        i < (PageSize - 4) && /* This block has a chance to contain data AND */
+        buffer[i + 2] < (PageSize - i - 3)) {/* There is room for this block to be expanded */
 
-            // And store the value
-            buffer[i + 3 + rdAddr - baddr] = rdValue;
+        // Yes, do it
+        ++buffer[i + 2];
 
-          }
-          else {
+        // And store the value
+        buffer[i + 3 + rdAddr - baddr] = rdValue;
 
-            // No, we can't expand it - Skip the existing block
-            i += 3 + blen;
+      }
+      else {
 
-            // Can we create a new slot ?
-            if (i > (PageSize - 4)) {
+        // No, we can't expand it - Skip the existing block
+        i += 3 + blen;
 
-              // Not enough space - Write the current buffer to FLASH
-              ee_PageWrite(curwPage + curwGroup * PagesPerGroup, buffer);
+        // Can we create a new slot ?
+        if (i > (PageSize - 4)) {
 
-              // Advance write page (as we are compacting, should never overflow!)
-              ++curwPage;
+          // Not enough space - Write the current buffer to FLASH
+          ee_PageWrite(curwPage + curwGroup * PagesPerGroup, buffer);
 
-              // Clear RAM buffer
-              memset(buffer, 0xFF, sizeof(buffer));
+          // Advance write page (as we are compacting, should never overflow!)
+          ++curwPage;
 
-              // Start fresh */
-              i = 0;
-            }
+          // Clear RAM buffer
+          memset(buffer, 0xFF, sizeof(buffer));
 
-            // Enough space, add the new block
-            buffer[i] = rdAddr & 0xFF;
-            buffer[i + 1] = (rdAddr >> 8) & 0xFF;
-            buffer[i + 2] = 1;
-            buffer[i + 3] = rdValue;
-          }
+          // Start fresh */
+          i = 0;
         }
-      }
 
-      // Go to the next address
-      ++rdAddr;
-
-      // Repeat for bytes of this range
-    } while (--rdRange);
+        // Enough space, add the new block
+        buffer[i] = rdAddr & 0xFF;
+        buffer[i + 1] = (rdAddr >> 8) & 0xFF;
+        buffer[i + 2] = 1;
+        buffer[i + 3] = rdValue;
+      }
+    }
+  }
 
-    // Repeat until we run out of ranges
-  } while (rdAddr < EEPROMSize);
+  // Write the last compacted page before the old group is erased
+  if (buffer[2] != 0xFF) {
+    ee_PageWrite(curwPage + curwGroup * PagesPerGroup, buffer);
+    ++curwPage;
+    memset(buffer, 0xFF, sizeof(buffer));
+  }
 
   // We must erase the previous group, in preparation for the next swap
   for (int page = 0; page < curPage; page++) {
@@ -760,6 +619,8 @@ static bool ee_Write(uint32_t address, uint8_t data) {
   // If we were requested an address outside of the emulated range, fail now
   if (address >= EEPROMSize) return false;
 
+  eeImage[address] = data;
+
   // Lets check if we have a block with that data previously defined. Block
   //  start addresses are always sorted in ascending order
   uint16_t i = 0;
@@ -963,6 +824,8 @@ static void ee_Init() {
       ee_PageErase(curGroup * PagesPerGroup + page);
     }
   }
+
+  ee_LoadImage();
 }
 
 uint8_t eeprom_read_byte(uint8_t* addr) {
@@ -38,6 +38,48 @@
   #if DISABLED(SD_FINISHED_RELEASECOMMAND)
     #error "DEPENDENCY ERROR: Missing setting SD_FINISHED_RELEASECOMMAND."
   #endif
+  #if ENABLED(SD_CONTIGUOUS_READ)
+    #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
+      #error "DEPENDENCY ERROR: SD_CONTIGUOUS_READ requires SDSUPPORT."
+    #elif DISABLED(CPU_32_BIT)
+      #error "DEPENDENCY ERROR: SD_CONTIGUOUS_READ requires a 32 bit board."
+    #elif !defined(SD_CONTIGUOUS_READ_BLOCKS) || SD_CONTIGUOUS_READ_BLOCKS < 1
+      #error "DEPENDENCY ERROR: SD_CONTIGUOUS_READ_BLOCKS must be at least 1."
+    #endif
+  #endif
+  #if ENABLED(SD_JOB_META_CACHE)
+    #if DISABLED(JSON_OUTPUT) && DISABLED(ADAPTIVE_MESH_LEVELING)
+      #error "DEPENDENCY ERROR: SD_JOB_META_CACHE requires JSON_OUTPUT or ADAPTIVE_MESH_LEVELING."
+    #elif !defined(SD_JOB_META_SLOTS) || SD_JOB_META_SLOTS < 1
+      #error "DEPENDENCY ERROR: SD_JOB_META_SLOTS must be at least 1."
+    #endif
+  #endif
+  #if ENABLED(SDCARD_SORT_ALPHA) && ENABLED(SDSORT_USES_RAM)
+    #if !defined(SDSORT_POOL_SIZE) || SDSORT_POOL_SIZE < 64 || SDSORT_POOL_SIZE > 65535
+      #error "DEPENDENCY ERROR: SDSORT_POOL_SIZE must be from 64 to 65535."
+    #endif
+  #endif
+  #if ENABLED(SD_DIR_INDEX)
+    #if !defined(SD_DIR_INDEX_PAGE_SIZE) || SD_DIR_INDEX_PAGE_SIZE < 1
+      #error "DEPENDENCY ERROR: SD_DIR_INDEX_PAGE_SIZE must be at least 1."
+    #elif !defined(SD_DIR_INDEX_PAGES) || SD_DIR_INDEX_PAGES < 1
+      #error "DEPENDENCY ERROR: SD_DIR_INDEX_PAGES must be at least 1."
+    #elif SD_DIR_INDEX_PAGE_SIZE * SD_DIR_INDEX_PAGES > 65535
+      #error "DEPENDENCY ERROR: SD_DIR_INDEX_PAGE_SIZE * SD_DIR_INDEX_PAGES must be less than 65536."
+    #endif
+  #endif
+  #if ENABLED(SD_PREALLOCATE_WRITE) && (!defined(SD_PREALLOCATE_SIZE) || SD_PREALLOCATE_SIZE < 512)
+    #error "DEPENDENCY ERROR: SD_PREALLOCATE_SIZE must be at least 512."
+  #endif
+  #if ENABLED(SD_IO_WORKER) && (!defined(SD_IO_WORKER_BUFFER) || SD_IO_WORKER_BUFFER < 512 || SD_IO_WORKER_BUFFER % 512 || SD_IO_WORKER_BUFFER > 32768)
+    #error "DEPENDENCY ERROR: SD_IO_WORKER_BUFFER must be a multiple of 512 up to 32768."
+  #endif
+#elif ENABLED(BINARY_FILE_UPLOAD)
+  #error "DEPENDENCY ERROR: You have to enable SDSUPPORT || USB_FLASH_DRIVE_SUPPORT to use BINARY_FILE_UPLOAD."
+#elif ENABLED(SD_PREALLOCATE_WRITE)
+  #error "DEPENDENCY ERROR: You have to enable SDSUPPORT || USB_FLASH_DRIVE_SUPPORT to use SD_PREALLOCATE_WRITE."
+#elif ENABLED(SD_IO_WORKER)
+  #error "DEPENDENCY ERROR: You have to enable SDSUPPORT || USB_FLASH_DRIVE_SUPPORT to use SD_IO_WORKER."
 #elif ENABLED(EEPROM_SETTINGS) && ENABLED(EEPROM_SD)
   #error "DEPENDENCY ERROR: You have to enable SDSUPPORT || USB_FLASH_DRIVE_SUPPORT to use EEPROM_SD."
 #endif
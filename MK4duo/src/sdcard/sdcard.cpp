@@ -52,6 +52,13 @@ char  SDCard::fileName[LONG_FILENAME_LENGTH*SD_MAX_FOLDER_DEPTH+SD_MAX_FOLDER_DE
 /** Private Parameters */
 uint16_t SDCard::nrFile_index = 0;
 
+#if ENABLED(SD_CONTIGUOUS_READ)
+  uint32_t  SDCard::contiguous_block  = 0,
+            SDCard::read_pos          = 0,
+            SDCard::buffer_block      = 0;
+  uint8_t   SDCard::read_buffer[SD_CONTIGUOUS_READ_BLOCKS][512];
+#endif
+
 #if HAS_EEPROM_SD
   SdFile SDCard::eeprom_file;
 #endif
@@ -61,6 +68,13 @@ uint16_t  SDCard::workDirDepth  = 0,
 
 LsActionEnum SDCard::lsAction   = LS_Count;
 
+// Directory position of each page of the working directory
+#if ENABLED(SD_DIR_INDEX)
+  uint16_t  SDCard::dir_index_files = SD_DIR_INDEX_UNKNOWN,
+            SDCard::dir_index_pages = 0;
+  uint32_t  SDCard::dir_index_pos[SD_DIR_INDEX_PAGES];
+#endif
+
 // Sort files and folders alphabetically.
 #if ENABLED(SDCARD_SORT_ALPHA)
   uint16_t SDCard::sort_count = 0;
@@ -72,7 +86,7 @@ LsActionEnum SDCard::lsAction   = LS_Count;
 
   // By default the sort index is static
   #if ENABLED(SDSORT_DYNAMIC_RAM)
-    uint8_t *SDCard::sort_order;
+    uint8_t *SDCard::sort_order = nullptr;
   #else
     uint8_t SDCard::sort_order[SDSORT_LIMIT];
   #endif
@@ -80,24 +94,16 @@ LsActionEnum SDCard::lsAction   = LS_Count;
   // Cache filenames to speed up SD menus.
   #if ENABLED(SDSORT_USES_RAM)
 
-    // If using dynamic ram for names, allocate on the heap.
-    #if ENABLED(SDSORT_CACHE_NAMES)
-      #if ENABLED(SDSORT_DYNAMIC_RAM)
-        char **SDCard::sortshort, **SDCard::sortnames;
-      #else
-        char SDCard::sortnames[SDSORT_LIMIT][SORTED_LONGNAME_MAXLEN];
-      #endif
-    #elif DISABLED(SDSORT_USES_STACK)
-      char SDCard::sortnames[SDSORT_LIMIT][SORTED_LONGNAME_MAXLEN];
-    #endif
+    uint16_t SDCard::sort_pool_used = 0;
 
-    // Folder sorting uses an isDir array when caching items.
-    #if HAS_FOLDER_SORTING
-      #if ENABLED(SDSORT_DYNAMIC_RAM)
-        uint8_t *SDCard::isDir;
-      #elif ENABLED(SDSORT_CACHE_NAMES) || DISABLED(SDSORT_USES_STACK)
-        uint8_t SDCard::isDir[(SDSORT_LIMIT + 7) >> 3];
-      #endif
+    #if SDSORT_STATIC_NAMES
+      char      SDCard::sort_pool[SDSORT_POOL_SIZE];
+      uint16_t  SDCard::sort_offset[SDSORT_LIMIT];
+      uint8_t   SDCard::isDir[(SDSORT_LIMIT + 7) >> 3];
+    #else
+      char      *SDCard::sort_pool    = nullptr;
+      uint16_t  *SDCard::sort_offset  = nullptr;
+      uint8_t   *SDCard::isDir        = nullptr;
     #endif
 
   #endif // SDSORT_USES_RAM
@@ -195,15 +201,15 @@ void SDCard::ls() {
 }
 
 void SDCard::getfilename(uint16_t nr, PGM_P const match/*=NULL*/) {
-  #if ENABLED(SDCARD_SORT_ALPHA) && ENABLED(SDSORT_CACHE_NAMES)
+  #if ENABLED(SDCARD_SORT_ALPHA) && ENABLED(SDSORT_USES_RAM) && ENABLED(SDSORT_CACHE_NAMES)
     if (match != NULL) {
       while (nr < sort_count) {
-        if (strcasecmp(match, sortshort[nr]) == 0) break;
+        if (strcasecmp(match, sort_name(nr)) == 0) break;
         nr++;
       }
     }
     if (nr < sort_count) {
-      strcpy(fileName, sortnames[nr]);
+      strcpy(fileName, sort_name(nr));
       setFilenameIsDir(TEST(isDir[nr>>3], nr & 0x07));
       return;
     }
@@ -258,7 +264,6 @@ void SDCard::write_command(char* buf) {
   char* npos = 0;
   char* end = buf + strlen(buf) - 1;
 
-  gcode_file.clearWriteError();
   if ((npos = strchr(buf, 'N')) != NULL) {
     begin = strchr(npos, ' ') + 1;
     end = strchr(npos, '*') - 1;
@@ -266,10 +271,15 @@ void SDCard::write_command(char* buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  gcode_file.write(begin);
-  if (gcode_file.getWriteError()) {
-    SERIAL_LM(ER, MSG_SD_ERR_WRITE_TO_FILE);
-  }
+  #if ENABLED(SD_IO_WORKER)
+    (void)sdworker.write(begin, strlen(begin)); // Errors are reported by the worker
+  #else
+    gcode_file.clearWriteError();
+    gcode_file.write(begin);
+    if (gcode_file.getWriteError()) {
+      SERIAL_LM(ER, MSG_SD_ERR_WRITE_TO_FILE);
+    }
+  #endif
 }
 
 void SDCard::print_status() {
@@ -285,11 +295,21 @@ void SDCard::startWrite(char *filename, const bool silent/*=false*/) {
   if (!isDetected()) return;
 
   fat.chdir();
-  if (!gcode_file.open(filename, FILE_WRITE)) {
+
+  bool opened = false;
+  #if ENABLED(SD_PREALLOCATE_WRITE)
+    // A new file is preallocated, an existing one is appended
+    if (!fat.exists(filename)) opened = create_contiguous(filename, SD_PREALLOCATE_SIZE);
+  #endif
+
+  if (!opened && !gcode_file.open(filename, FILE_WRITE)) {
     SERIAL_LMT(ER, MSG_SD_OPEN_FILE_FAIL, filename);
   }
   else {
     setSaving(true);
+    #if ENABLED(SD_DIR_INDEX)
+      flush_dir_index();
+    #endif
     #if ENABLED(EMERGENCY_PARSER)
       emergency_parser.disable();
     #endif
@@ -300,10 +320,39 @@ void SDCard::startWrite(char *filename, const bool silent/*=false*/) {
   }
 }
 
+#if ENABLED(BINARY_FILE_UPLOAD) || ENABLED(SD_PREALLOCATE_WRITE)
+
+  /**
+   * Create the file preallocated on size bytes of contiguous clusters.
+   * Writes inside it never extend the FAT, the unused part is freed on close.
+   */
+  bool SDCard::startContiguousWrite(char *filename, const uint32_t size) {
+    if (!isDetected()) return false;
+
+    fat.chdir();
+    if (!create_contiguous(filename, size)) {
+      SERIAL_LMT(ER, MSG_SD_OPEN_FILE_FAIL, filename);
+      return false;
+    }
+
+    setSaving(true);
+    #if ENABLED(EMERGENCY_PARSER)
+      emergency_parser.disable();
+    #endif
+    SERIAL_EMT(MSG_SD_WRITE_TO_FILE, filename);
+    lcdui.set_status(filename);
+    return true;
+  }
+
+#endif
+
 void SDCard::deleteFile(char *filename) {
   if (!isDetected()) return;
   setPrinting(false);
   gcode_file.close();
+  #if ENABLED(SD_DIR_INDEX)
+    flush_dir_index();
+  #endif
   if (fat.remove(filename)) {
     SERIAL_EMT(MSG_SD_FILE_DELETED, filename);
   }
@@ -321,8 +370,7 @@ void SDCard::deleteFile(char *filename) {
 }
 
 void SDCard::finishWrite() {
-  gcode_file.sync();
-  gcode_file.close();
+  close_write_file();
   setSaving(false);
   SERIAL_EM(MSG_SD_FILE_SAVED);
 }
@@ -331,6 +379,9 @@ void SDCard::makeDirectory(char *filename) {
   if (!isDetected()) return;
   setPrinting(false);
   gcode_file.close();
+  #if ENABLED(SD_DIR_INDEX)
+    flush_dir_index();
+  #endif
   if (fat.mkdir(filename)) {
     SERIAL_EM(MSG_SD_DIRECTORY_CREATED);
   }
@@ -340,8 +391,7 @@ void SDCard::makeDirectory(char *filename) {
 }
 
 void SDCard::closeFile() {
-  gcode_file.sync();
-  gcode_file.close();
+  close_write_file();
   setSaving(false);
   #if ENABLED(EMERGENCY_PARSER)
     emergency_parser.enable();
@@ -389,6 +439,9 @@ void SDCard::chdir(PGM_P relpath) {
     workDir = newDir;
     if (workDirDepth < SD_MAX_FOLDER_DEPTH)
       workDirParents[workDirDepth++] = workDir;
+    #if ENABLED(SD_DIR_INDEX)
+      flush_dir_index();
+    #endif
     #if ENABLED(SDCARD_SORT_ALPHA)
       presort();
     #endif
@@ -430,6 +483,9 @@ void SDCard::checkautostart() {
 
 void SDCard::setroot() {
   workDir = root;
+  #if ENABLED(SD_DIR_INDEX)
+    flush_dir_index();
+  #endif
   #if ENABLED(SDCARD_SORT_ALPHA)
     presort();
   #endif
@@ -459,6 +515,9 @@ bool SDCard::selectFile(PGM_P filename, const bool silent/*=false*/) {
   if (!isDetected()) return false;
 
   gcode_file.close();
+  #if ENABLED(SD_CONTIGUOUS_READ)
+    contiguous_block = 0;
+  #endif
   if (gcode_file.open(&workDir, filename, O_READ)) {
     if ((fname = strrchr(filename, '/')) != NULL)
       fname++;
@@ -468,6 +527,16 @@ bool SDCard::selectFile(PGM_P filename, const bool silent/*=false*/) {
     fileSize = gcode_file.fileSize();
     sdpos = 0;
 
+    #if ENABLED(SD_CONTIGUOUS_READ)
+      // Checked once here, reads need no FAT lookups after this
+      uint32_t first_block, last_block;
+      if (gcode_file.contiguousRange(&first_block, &last_block)) {
+        contiguous_block = first_block;
+        read_pos = 0;
+        buffer_block = 0xFFFFFFFF;  // Empty buffer
+      }
+    #endif
+
     if (!silent) {
       SERIAL_MT(MSG_SD_FILE_OPENED, fname);
       SERIAL_EMV(MSG_SD_SIZE, fileSize);
@@ -477,8 +546,21 @@ bool SDCard::selectFile(PGM_P filename, const bool silent/*=false*/) {
       const_cast<char&>(fileName[c]) = '\0';
     strncpy(fileName, filename, strlen(filename));
 
-    #if ENABLED(JSON_OUTPUT)
-      parsejson(gcode_file);
+    #if ENABLED(SD_JOB_META_CACHE)
+      if (!load_job_meta()) {
+    #endif
+
+        #if ENABLED(ADAPTIVE_MESH_LEVELING)
+          parse_print_area(gcode_file);
+        #endif
+
+        #if ENABLED(JSON_OUTPUT)
+          parsejson(gcode_file);
+        #endif
+
+    #if ENABLED(SD_JOB_META_CACHE)
+        save_job_meta();
+      }
     #endif
 
     return true;
@@ -492,6 +574,9 @@ bool SDCard::selectFile(PGM_P filename, const bool silent/*=false*/) {
 int8_t SDCard::updir() {
   if (workDirDepth > 0) {                                               // At least 1 dir has been saved
     workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
+    #if ENABLED(SD_DIR_INDEX)
+      flush_dir_index();
+    #endif
     #if ENABLED(SDCARD_SORT_ALPHA)
       presort();
     #endif
@@ -500,6 +585,9 @@ int8_t SDCard::updir() {
 }
 
 uint16_t SDCard::getnrfilenames() {
+  #if ENABLED(SD_DIR_INDEX)
+    if (dir_index_files != SD_DIR_INDEX_UNKNOWN) return (nrFiles = dir_index_files);
+  #endif
   lsAction = LS_Count;
   nrFiles = 0;
   lsDive(workDir);
@@ -524,6 +612,10 @@ uint16_t SDCard::get_num_Files() {
 
     if (!isDetected() || restart.job_file.isOpen()) return;
 
+    #if ENABLED(SD_DIR_INDEX)
+      if (!read) flush_dir_index();
+    #endif
+
     if (!restart.job_file.open(fat.vwd(), restart_file_name, read ? O_READ : (O_RDWR | O_CREAT | O_SYNC)))
       SERIAL_LMT(ER, MSG_SD_OPEN_FILE_FAIL, restart_file_name);
     else if (!read) {
@@ -531,8 +623,28 @@ uint16_t SDCard::get_num_Files() {
     }
   }
 
+  // Create the restart file preallocated, so writes inside it never touch the directory
+  bool SDCard::create_restart_file(const uint32_t size) {
+
+    if (!isDetected() || restart.job_file.isOpen()) return false;
+
+    #if ENABLED(SD_DIR_INDEX)
+      flush_dir_index();
+    #endif
+
+    if (!restart.job_file.createContiguous(fat.vwd(), restart_file_name, size)) {
+      SERIAL_LMT(ER, MSG_SD_OPEN_FILE_FAIL, restart_file_name);
+      return false;
+    }
+    if (printer.debugFeature()) DEBUG_EMT(MSG_SD_WRITE_TO_FILE, restart_file_name);
+    return true;
+  }
+
   void SDCard::delete_restart_file() {
     if (exist_restart_file()) {
+      #if ENABLED(SD_DIR_INDEX)
+        flush_dir_index();
+      #endif
       restart.job_file.remove(fat.vwd(), restart_file_name);
       DEBUG_SM(DEB, " File restart delete");
       DEBUG_STR(restart.job_file.open(fat.vwd(), restart_file_name, O_READ) ? PSTR(" failed.\n") : PSTR("d.\n"));
@@ -555,6 +667,9 @@ uint16_t SDCard::get_num_Files() {
   void SDCard::import_eeprom() {
     if (!isDetected()) mount();
     if (!isDetected()) SERIAL_LM(ER, MSG_NO_CARD);
+    #if ENABLED(SD_DIR_INDEX)
+      flush_dir_index();
+    #endif
     if (!eeprom_file.open("eeprom", O_RDWR | O_CREAT | O_SYNC) ||
       eeprom_file.read(memorystore.eeprom_data, EEPROM_SIZE) != EEPROM_SIZE) {
       DEBUG_LM(DEB, MSG_SD_OPEN_FILE_FAIL "eeprom");
@@ -576,6 +691,47 @@ uint16_t SDCard::get_num_Files() {
 
 #endif
 
+#if ENABLED(AUTO_BED_LEVELING_UBL) && UBL_MESH_SD_SLOTS > 0
+
+  /**
+   * Mesh slots on the SD card, one file meshNN.dat in the root for each slot.
+   * Return 'true' on error as the MemoryStore functions.
+   */
+  bool SDCard::write_mesh_file(const uint8_t index, const void * const data, const uint16_t size) {
+    if (!isDetected()) {
+      SERIAL_LM(ER, MSG_NO_CARD);
+      return true;
+    }
+    char name[13];
+    sprintf_P(name, PSTR("mesh%02i.dat"), int(index));
+    SdFile mesh_file;
+    #if ENABLED(SD_DIR_INDEX)
+      flush_dir_index();
+    #endif
+    const bool failed = !mesh_file.open(&root, name, O_WRITE | O_CREAT | O_TRUNC)
+                     || mesh_file.write(data, size) != size;
+    mesh_file.close();
+    if (failed) SERIAL_LMT(ER, MSG_SD_OPEN_FILE_FAIL, name);
+    return failed;
+  }
+
+  bool SDCard::read_mesh_file(const uint8_t index, void * const data, const uint16_t size) {
+    if (!isDetected()) {
+      SERIAL_LM(ER, MSG_NO_CARD);
+      return true;
+    }
+    char name[13];
+    sprintf_P(name, PSTR("mesh%02i.dat"), int(index));
+    SdFile mesh_file;
+    const bool failed = !mesh_file.open(&root, name, O_READ)
+                     || mesh_file.read(data, size) != size;
+    mesh_file.close();
+    if (failed) SERIAL_LMT(ER, MSG_SD_OPEN_FILE_FAIL, name);
+    return failed;
+  }
+
+#endif
+
 #if ENABLED(SDCARD_SORT_ALPHA)
 
   /**
@@ -622,25 +778,39 @@ uint16_t SDCard::get_num_Files() {
       #endif
 
       // Use RAM to store the entire directory during pre-sort.
-      // SDSORT_LIMIT should be set to prevent over-allocation.
+      // SDSORT_LIMIT and SDSORT_POOL_SIZE should be set to prevent over-allocation.
       #if ENABLED(SDSORT_USES_RAM)
 
         // If using dynamic ram for names, allocate on the heap.
-        #if ENABLED(SDSORT_CACHE_NAMES)
-          #if ENABLED(SDSORT_DYNAMIC_RAM)
-            sortnames = new char*[fileCnt];
-          #endif
-        #elif ENABLED(SDSORT_USES_STACK)
-          char sortnames[fileCnt][SORTED_LONGNAME_MAXLEN];
+        #if ENABLED(SDSORT_DYNAMIC_RAM)
+          sort_pool   = (char*)malloc(SDSORT_POOL_SIZE);
+          sort_offset = new uint16_t[fileCnt];
+          isDir       = new uint8_t[(fileCnt + 7) >> 3];
+        #elif !SDSORT_STATIC_NAMES
+          char      stack_pool[SDSORT_POOL_SIZE];
+          uint16_t  stack_offset[fileCnt];
+          uint8_t   stack_isDir[(fileCnt + 7) >> 3];
+          sort_pool   = stack_pool;
+          sort_offset = stack_offset;
+          isDir       = stack_isDir;
         #endif
 
-        // Folder sorting needs 1 bit per entry for flags.
-        #if HAS_FOLDER_SORTING
-          #if ENABLED(SDSORT_DYNAMIC_RAM)
-            isDir = new uint8_t[(fileCnt + 7) >> 3];
-          #elif ENABLED(SDSORT_USES_STACK)
-            uint8_t isDir[(fileCnt + 7) >> 3];
-          #endif
+        // Read all the names with one pass of the directory.
+        // The files after a full pool are left unsorted.
+        sort_pool_used = 0;
+        lsAction = LS_SortNames;
+        nrFile_index = fileCnt;
+        #if ENABLED(SDSORT_DYNAMIC_RAM)
+          if (sort_pool)
+        #endif
+            lsDive(workDir);
+        fileCnt = sort_count;
+        sort_count = 0;
+
+        #if ENABLED(SDSORT_DYNAMIC_RAM) && ENABLED(SDSORT_CACHE_NAMES)
+          // Give back the part of the pool not used
+          char * const pool = sort_pool_used ? (char*)realloc(sort_pool, sort_pool_used) : nullptr;
+          if (pool) sort_pool = pool;
         #endif
 
       #else // !SDSORT_USES_RAM
@@ -652,36 +822,10 @@ uint16_t SDCard::get_num_Files() {
 
       #endif
 
-      if (fileCnt > 1) {
+      // Init sort order.
+      for (uint16_t i = 0; i < fileCnt; i++) sort_order[i] = i;
 
-        // Init sort order.
-        for (uint16_t i = 0; i < fileCnt; i++) {
-          sort_order[i] = i;
-          // If using RAM then read all filenames now.
-          #if ENABLED(SDSORT_USES_RAM)
-            getfilename(i);
-            #if ENABLED(SDSORT_DYNAMIC_RAM)
-              // Use dynamic method to copy long filename
-              sortnames[i] = strdup(fileName);
-            #else
-              // Copy filenames into the static array
-              #if SORTED_LONGNAME_MAXLEN != LONG_FILENAME_LENGTH
-                strncpy(sortnames[i], fileName, SORTED_LONGNAME_MAXLEN);
-                sortnames[i][SORTED_LONGNAME_MAXLEN - 1] = '\0';
-              #else
-                strcpy(sortnames[i], SORTED_LONGNAME_MAXLEN);
-              #endif
-            #endif
-            // char out[30];
-            // sprintf_P(out, PSTR("---- %i %s %s"), i, isFilenameIsDir( ? "D" : " ", sortnames[i]);
-            // SERIAL_ECHOLN(out);
-            #if HAS_FOLDER_SORTING
-              const uint16_t bit = i & 0x07, ind = i >> 3;
-              if (bit == 0) isDir[ind] = 0x00;
-              if (isFilenameIsDir()) isDir[ind] |= _BV(bit);
-            #endif
-          #endif
-        }
+      if (fileCnt > 1) {
 
         // Bubble Sort
         for (uint16_t i = fileCnt; --i;) {
@@ -689,9 +833,9 @@ uint16_t SDCard::get_num_Files() {
           for (uint16_t j = 0; j < i; ++j) {
             const uint16_t o1 = sort_order[j], o2 = sort_order[j + 1];
 
-            // Compare names from the array or just the two buffered names
+            // Compare names from the pool or just the two buffered names
             #if ENABLED(SDSORT_USES_RAM)
-              #define _SORT_CMP_NODIR() (strcasecmp(sortnames[o1], sortnames[o2]) > 0)
+              #define _SORT_CMP_NODIR() (strcasecmp(sort_name(o1), sort_name(o2)) > 0)
             #else
               #define _SORT_CMP_NODIR() (strcasecmp(name1, name2) > 0)
             #endif
@@ -741,49 +885,63 @@ uint16_t SDCard::get_num_Files() {
           }
           if (!didSwap) break;
         }
-        // Using RAM but not keeping names around
-        #if ENABLED(SDSORT_USES_RAM) && DISABLED(SDSORT_CACHE_NAMES)
-          #if ENABLED(SDSORT_DYNAMIC_RAM)
-            for (uint16_t i = 0; i < fileCnt; ++i) free(sortnames[i]);
-            #if HAS_FOLDER_SORTING
-              free(isDir);
-            #endif
-          #endif
-        #endif
-      }
-      else {
-        sort_order[0] = 0;
-        #if ENABLED(SDSORT_USES_RAM) && ENABLED(SDSORT_CACHE_NAMES)
-          getfilename(0);
-          #if ENABLED(SDSORT_DYNAMIC_RAM)
-            sortnames = new char*[1];
-            sortnames[0] = strdup(fileName); // malloc
-            isDir = new uint8_t[1];
-          #else
-            #if SORTED_LONGNAME_MAXLEN != LONG_FILENAME_LENGTH
-              strncpy(sortnames[0], fileName, SORTED_LONGNAME_MAXLEN);
-              sortnames[0][SORTED_LONGNAME_MAXLEN - 1] = '\0';
-            #else
-              strcpy(sortnames[0], SORTED_LONGNAME_MAXLEN);
-            #endif
-          #endif
-          isDir[0] = isFilenameIsDir() ? 0x01 : 0x00;
-        #endif
+
       }
 
+      // Using RAM but not keeping names around
+      #if ENABLED(SDSORT_USES_RAM) && DISABLED(SDSORT_CACHE_NAMES) && ENABLED(SDSORT_DYNAMIC_RAM)
+        free_sort_names();
+      #endif
+
       sort_count = fileCnt;
     }
   }
 
   void SDCard::flush_presort() {
-    if (sort_count > 0) {
-      #if ENABLED(SDSORT_DYNAMIC_RAM)
-        delete sort_order;
+    #if ENABLED(SDSORT_DYNAMIC_RAM)
+      delete [] sort_order;
+      sort_order = nullptr;
+      #if ENABLED(SDSORT_USES_RAM)
+        free_sort_names();
       #endif
-      sort_count = 0;
-    }
+    #endif
+    sort_count = 0;
   }
 
+  #if ENABLED(SDSORT_USES_RAM)
+
+    // Append the name of the entry just read to the pool
+    bool SDCard::sort_add_name() {
+      const uint16_t len = MIN(strlen(tempLongFilename), size_t(SORTED_LONGNAME_MAXLEN - 1));
+      if (sort_pool_used + len + 1 > SDSORT_POOL_SIZE) return false;
+
+      char * const name = &sort_pool[sort_pool_used];
+      memcpy(name, tempLongFilename, len);
+      name[len] = '\0';
+      sort_offset[sort_count] = sort_pool_used;
+      sort_pool_used += len + 1;
+
+      const uint16_t bit = sort_count & 0x07, ind = sort_count >> 3;
+      if (bit == 0) isDir[ind] = 0x00;
+      if (isFilenameIsDir()) isDir[ind] |= _BV(bit);
+
+      sort_count++;
+      return true;
+    }
+
+    #if ENABLED(SDSORT_DYNAMIC_RAM)
+      void SDCard::free_sort_names() {
+        free(sort_pool);
+        delete [] sort_offset;
+        delete [] isDir;
+        sort_pool   = nullptr;
+        sort_offset = nullptr;
+        isDir       = nullptr;
+      }
+    #endif
+
+  #endif // SDSORT_USES_RAM
+
 #endif // SDCARD_SORT_ALPHA
 
 #if ENABLED(ADVANCED_SD_COMMAND)
@@ -858,19 +1016,111 @@ uint16_t SDCard::get_num_Files() {
 #endif
 
 /** Private Function */
+
+#if ENABLED(SD_CONTIGUOUS_READ)
+
+  int16_t SDCard::get_contiguous() {
+    sdpos = read_pos;
+    if (read_pos >= fileSize) return -1;
+
+    const uint32_t block = read_pos >> 9;
+    if (block - buffer_block >= SD_CONTIGUOUS_READ_BLOCKS || block < buffer_block) {
+      if (!read_blocks(block)) {
+        // Go on through the FAT
+        contiguous_block = 0;
+        gcode_file.seekSet(read_pos);
+        return get();
+      }
+    }
+
+    const uint8_t c = read_buffer[block - buffer_block][read_pos & 0x1FF];
+    read_pos++;
+    return c;
+  }
+
+  /**
+   * Fill the read buffer from file block with one multi-block read.
+   * The read is stopped at the end so the SPI bus is free between fills.
+   */
+  bool SDCard::read_blocks(const uint32_t block) {
+    const uint32_t  last_block  = (fileSize - 1) >> 9;
+    const uint8_t   count       = MIN(uint32_t(SD_CONTIGUOUS_READ_BLOCKS), last_block - block + 1);
+    SdSpiCard * const sd = fat.card();
+
+    if (!sd->readStart(contiguous_block + block)) return false;
+    for (uint8_t i = 0; i < count; i++) {
+      if (!sd->readData(read_buffer[i])) {
+        sd->readStop();
+        return false;
+      }
+    }
+    if (!sd->readStop()) return false;
+
+    buffer_block = block;
+    return true;
+  }
+
+#endif // ENABLED(SD_CONTIGUOUS_READ)
+
+#if ENABLED(BINARY_FILE_UPLOAD) || ENABLED(SD_PREALLOCATE_WRITE)
+
+  // Replace the file with a new one on size bytes of contiguous clusters
+  bool SDCard::create_contiguous(char *filename, const uint32_t size) {
+    fat.remove(filename);
+    #if ENABLED(SD_DIR_INDEX)
+      flush_dir_index();
+    #endif
+    if (!gcode_file.createContiguous(fat.vwd(), filename, size)) return false;
+    flag.Preallocated = true;
+    return true;
+  }
+
+#endif
+
+// Close the file, freeing the preallocated clusters not written
+void SDCard::close_write_file() {
+  #if ENABLED(SD_IO_WORKER)
+    (void)sdworker.flush();
+  #endif
+  if (flag.Preallocated) {
+    gcode_file.truncate(gcode_file.curPosition());
+    flag.Preallocated = false;
+  }
+  gcode_file.sync();
+  gcode_file.close();
+}
+
 /**
  * Dive into a folder and recurse depth-first to perform a pre-set operation lsAction:
  *   LS_Count       - Add +1 to nrFiles for every file within the parent
  *   LS_GetFilename - Get the filename of the file indexed by nrFile_index
+ *
+ * With SD_DIR_INDEX the position of the first entry of each page is stored
+ * while walking, and a lookup by index starts from the page of the file.
  */
 void SDCard::lsDive(SdFile parent, PGM_P const match/*=NULL*/) {
   //dir_t* p = NULL;
   SdFile file;
   parent.rewind();
-  uint8_t cnt = 0;
+  uint16_t cnt = 0;
+
+  #if ENABLED(SD_DIR_INDEX)
+    if (lsAction == LS_GetFilename && match == NULL && dir_index_pages) {
+      const uint16_t page = MIN(nrFile_index / (SD_DIR_INDEX_PAGE_SIZE), dir_index_pages - 1);
+      parent.seekSet(dir_index_pos[page]);
+      cnt = page * (SD_DIR_INDEX_PAGE_SIZE);
+    }
+  #endif
 
   // Read the next entry from a directory
-  while (file.openNext(&parent, O_READ)) {
+  for (;;) {
+
+    #if ENABLED(SD_DIR_INDEX)
+      const uint32_t entry_pos = parent.curPosition();
+    #endif
+
+    if (!file.openNext(&parent, O_READ)) break;
+
     file.getName(tempLongFilename, LONG_FILENAME_LENGTH);
 
     if (workDirDepth >= SD_MAX_FOLDER_DEPTH && strcmp(tempLongFilename, "..") == 0) {
@@ -889,6 +1139,13 @@ void SDCard::lsDive(SdFile parent, PGM_P const match/*=NULL*/) {
 
     setFilenameIsDir(file.isSubDir());
 
+    #if ENABLED(SD_DIR_INDEX)
+      // Remember the start of a new page
+      const uint16_t entry = lsAction == LS_Count ? nrFiles : cnt;
+      if (entry == dir_index_pages * (SD_DIR_INDEX_PAGE_SIZE) && dir_index_pages < SD_DIR_INDEX_PAGES)
+        dir_index_pos[dir_index_pages++] = entry_pos;
+    #endif
+
     switch (lsAction) {
       case LS_Count:
         nrFiles++;
@@ -908,11 +1165,171 @@ void SDCard::lsDive(SdFile parent, PGM_P const match/*=NULL*/) {
         cnt++;
         file.close();
         break;
+      #if ENABLED(SDCARD_SORT_ALPHA) && ENABLED(SDSORT_USES_RAM)
+        case LS_SortNames:
+          file.close();
+          if (sort_count >= nrFile_index || !sort_add_name()) return;
+          break;
+      #endif
+      default: break;
     }
 
   } // while readDir
+
+  #if ENABLED(SD_DIR_INDEX)
+    if (lsAction == LS_Count) dir_index_files = nrFiles;
+  #endif
 }
 
+#if ENABLED(SD_JOB_META_CACHE)
+
+  /**
+   * The header values of the jobs are cached in the hidden file .jobmeta
+   * of the working directory, made of SD_JOB_META_SLOTS records.
+   * A job uses the record chosen by its first cluster, so a lookup
+   * reads one record and a job with another key replaces the record.
+   */
+  constexpr char job_meta_file_name[] = ".jobmeta";
+
+  inline uint32_t job_meta_pos(const job_meta_t &meta) {
+    return (meta.cluster % (SD_JOB_META_SLOTS)) * sizeof(job_meta_t);
+  }
+
+  bool SDCard::job_meta_key(job_meta_t &meta) {
+    dir_t dir;
+    if (!gcode_file.dirEntry(&dir)) return false;
+    meta.cluster  = gcode_file.firstCluster();
+    meta.size     = dir.fileSize;
+    meta.date     = dir.lastWriteDate;
+    meta.time     = dir.lastWriteTime;
+    return meta.cluster != 0;   // Empty files are not cached
+  }
+
+  bool SDCard::load_job_meta() {
+    job_meta_t key, meta;
+    if (!job_meta_key(key)) return false;
+
+    SdFile meta_file;
+    if (!meta_file.open(&workDir, job_meta_file_name, O_READ)) return false;
+    const bool read_ok = meta_file.seekSet(job_meta_pos(key)) && meta_file.read(&meta, sizeof(meta)) == sizeof(meta);
+    meta_file.close();
+    if (!read_ok) return false;
+
+    uint16_t crc = 0;
+    crc16(&crc, &meta, offsetof(job_meta_t, crc));
+    if (crc != meta.crc || meta.cluster != key.cluster || meta.size != key.size
+      || meta.date != key.date || meta.time != key.time
+    ) return false;
+
+    filamentNeeded    = meta.filamentNeeded;
+    objectHeight      = meta.objectHeight;
+    firstlayerHeight  = meta.firstlayerHeight;
+    layerHeight       = meta.layerHeight;
+    meta.generatedBy[GENBY_SIZE - 1] = '\0';
+    strcpy(generatedBy, meta.generatedBy);
+
+    #if ENABLED(ADAPTIVE_MESH_LEVELING)
+      if (isnan(meta.area[0]))
+        bedlevel.clear_print_area();
+      else
+        bedlevel.set_print_area(meta.area[0], meta.area[1], meta.area[2], meta.area[3]);
+    #endif
+
+    return true;
+  }
+
+  void SDCard::save_job_meta() {
+    job_meta_t meta;
+    memset(&meta, 0, sizeof(meta));
+    if (!job_meta_key(meta)) return;
+
+    meta.filamentNeeded   = filamentNeeded;
+    meta.objectHeight     = objectHeight;
+    meta.firstlayerHeight = firstlayerHeight;
+    meta.layerHeight      = layerHeight;
+    strncpy(meta.generatedBy, generatedBy, GENBY_SIZE - 1);
+
+    #if ENABLED(ADAPTIVE_MESH_LEVELING)
+      if (bedlevel.flag.print_area) {
+        meta.area[0] = bedlevel.print_area_min[X_AXIS];
+        meta.area[1] = bedlevel.print_area_min[Y_AXIS];
+        meta.area[2] = bedlevel.print_area_max[X_AXIS];
+        meta.area[3] = bedlevel.print_area_max[Y_AXIS];
+      }
+      else
+    #endif
+        meta.area[0] = meta.area[1] = meta.area[2] = meta.area[3] = NAN;
+
+    meta.crc = 0;
+    crc16(&meta.crc, &meta, offsetof(job_meta_t, crc));
+
+    SdFile meta_file;
+    if (!meta_file.open(&workDir, job_meta_file_name, O_RDWR | O_CREAT)) return;
+
+    // A new file gets all the records, empty ones have cluster 0
+    if (meta_file.fileSize() < uint32_t(SD_JOB_META_SLOTS) * sizeof(job_meta_t)) {
+      job_meta_t empty;
+      memset(&empty, 0, sizeof(empty));
+      meta_file.seekSet(0);
+      for (uint16_t i = 0; i < SD_JOB_META_SLOTS; i++) meta_file.write(&empty, sizeof(empty));
+    }
+
+    if (meta_file.seekSet(job_meta_pos(meta))) meta_file.write(&meta, sizeof(meta));
+    meta_file.close();
+  }
+
+#endif // ENABLED(SD_JOB_META_CACHE)
+
+#if ENABLED(ADAPTIVE_MESH_LEVELING)
+
+  /**
+   * Read the XY bounding box of the job from the header of the file
+   * (Cura ;MINX: ;MINY: ;MAXX: ;MAXY:) for the adaptive mesh G29 U
+   */
+  void SDCard::parse_print_area(SdFile &parser_file) {
+
+    #define PA_BUF_SIZE 120
+
+    float area[4] = { NAN, NAN, NAN, NAN };
+    char  buf[PA_BUF_SIZE + 1];
+
+    bedlevel.clear_print_area();
+
+    // The header is in the first 1KB, the buffers overlap by 20 chars for the cut lines
+    for (uint16_t i = 0; i < 1024; i += PA_BUF_SIZE - 20) {
+      if (!parser_file.seekSet(i)) break;
+      const int16_t n = parser_file.read(buf, PA_BUF_SIZE);
+      if (n <= 0) break;
+      buf[n] = '\0';
+      if (isnan(area[0])) findHeaderValue(buf, PSTR(";MINX:"), area[0]);
+      if (isnan(area[1])) findHeaderValue(buf, PSTR(";MINY:"), area[1]);
+      if (isnan(area[2])) findHeaderValue(buf, PSTR(";MAXX:"), area[2]);
+      if (isnan(area[3])) findHeaderValue(buf, PSTR(";MAXY:"), area[3]);
+      if (!isnan(area[0]) && !isnan(area[1]) && !isnan(area[2]) && !isnan(area[3])) {
+        bedlevel.set_print_area(area[0], area[1], area[2], area[3]);
+        break;
+      }
+    }
+
+    parser_file.rewind();
+  }
+
+  /**
+   * Value after key, only if the whole line is in the buffer
+   */
+  bool SDCard::findHeaderValue(char* buf, PGM_P key, float &value) {
+    char *pos = strstr_P(buf, key);
+    if (!pos) return false;
+    pos += strlen_P(key);
+    char *q;
+    const float v = strtod(pos, &q);
+    if (q == pos || (*q != '\r' && *q != '\n')) return false;
+    value = v;
+    return true;
+  }
+
+#endif // ENABLED(ADAPTIVE_MESH_LEVELING)
+
 // --------------------------------------------------------------- //
 // Code that gets gcode information is adapted from RepRapFirmware //
 // Originally licenced under GPL                                   //
@@ -25,6 +25,10 @@
 
 #include "SdFat/SdFat.h"
 
+#if ENABLED(SD_DIR_INDEX)
+  #define SD_DIR_INDEX_UNKNOWN 0xFFFF
+#endif
+
 union flagcard_t {
   uint8_t all;
   struct {
@@ -34,12 +38,29 @@ union flagcard_t {
     bool  Autoreport      : 1;
     bool  Abortprinting   : 1;
     bool  FilenameIsDir   : 1;
-    bool  bit6            : 1;
+    bool  Preallocated    : 1;
     bool  bit7            : 1;
   };
   flagcard_t() { all = 0x00; }
 };
 
+#if ENABLED(SD_JOB_META_CACHE)
+  // Header values of a job, a record of the file .jobmeta
+  typedef struct {
+    uint32_t  cluster,              // Key: first cluster, size and write time of the job
+              size;
+    uint16_t  date,
+              time;
+    float     filamentNeeded,
+              objectHeight,
+              firstlayerHeight,
+              layerHeight,
+              area[4];              // Print area MINX MINY MAXX MAXY, NAN if not in the header
+    char      generatedBy[GENBY_SIZE];
+    uint16_t  crc;
+  } job_meta_t;
+#endif
+
 class SDCard {
 
   public: /** Constructor */
@@ -74,6 +95,13 @@ class SDCard {
 
     static uint16_t nrFile_index;
 
+    #if ENABLED(SD_CONTIGUOUS_READ)
+      static uint32_t contiguous_block,   // First card block of a contiguous file, 0 to read through the FAT
+                      read_pos,           // Next byte to read
+                      buffer_block;       // First file block in the read buffer
+      static uint8_t  read_buffer[SD_CONTIGUOUS_READ_BLOCKS][512];
+    #endif
+
     #if HAS_EEPROM_SD
       static SdFile eeprom_file;
     #endif
@@ -82,6 +110,12 @@ class SDCard {
                         nrFiles;          // counter for the files in the current directory and recycled as position counter for getting the nrFiles'th name in the directory.
     static LsActionEnum lsAction;         // stored for recursion.
 
+    #if ENABLED(SD_DIR_INDEX)
+      static uint16_t dir_index_files,    // Files in the working directory, SD_DIR_INDEX_UNKNOWN until counted
+                      dir_index_pages;    // Pages with a known position
+      static uint32_t dir_index_pos[SD_DIR_INDEX_PAGES];  // Directory position of the first file of each page
+    #endif
+
     // Sort files and folders alphabetically.
     #if ENABLED(SDCARD_SORT_ALPHA)
       static uint16_t sort_count;         // Count of sorted items in the current directory
@@ -105,26 +139,22 @@ class SDCard {
       #endif
 
       // Cache filenames to speed up SD menus.
+      // The names are packed one after the other in a pool, each found by its offset.
       #if ENABLED(SDSORT_USES_RAM)
 
-        // If using dynamic ram for names, allocate on the heap.
-        #if ENABLED(SDSORT_CACHE_NAMES)
-          #if ENABLED(SDSORT_DYNAMIC_RAM)
-            static char **sortshort, **sortnames;
-          #else
-            static char sortnames[SDSORT_LIMIT][SORTED_LONGNAME_MAXLEN];
-          #endif
-        #elif DISABLED(SDSORT_USES_STACK)
-          static char sortnames[SDSORT_LIMIT][SORTED_LONGNAME_MAXLEN];
-        #endif
+        #define SDSORT_STATIC_NAMES (DISABLED(SDSORT_DYNAMIC_RAM) && (ENABLED(SDSORT_CACHE_NAMES) || DISABLED(SDSORT_USES_STACK)))
 
-        // Folder sorting uses an isDir array when caching items.
-        #if HAS_FOLDER_SORTING
-          #if ENABLED(SDSORT_DYNAMIC_RAM)
-            static uint8_t *isDir;
-          #elif ENABLED(SDSORT_CACHE_NAMES) || DISABLED(SDSORT_USES_STACK)
-            static uint8_t isDir[(SDSORT_LIMIT + 7)>>3];
-          #endif
+        static uint16_t sort_pool_used;   // Bytes of the pool in use
+
+        #if SDSORT_STATIC_NAMES
+          static char     sort_pool[SDSORT_POOL_SIZE];
+          static uint16_t sort_offset[SDSORT_LIMIT];
+          static uint8_t  isDir[(SDSORT_LIMIT + 7)>>3];
+        #else
+          // Allocated by presort on the heap or on its stack
+          static char     *sort_pool;
+          static uint16_t *sort_offset;
+          static uint8_t  *isDir;
         #endif
 
       #endif // SDSORT_USES_RAM
@@ -179,6 +209,9 @@ class SDCard {
     static void print_status();
     static void startWrite(char* filename, const bool silent=false);
     static void deleteFile(char* filename);
+    #if ENABLED(BINARY_FILE_UPLOAD) || ENABLED(SD_PREALLOCATE_WRITE)
+      static bool startContiguousWrite(char* filename, const uint32_t size);
+    #endif
     static void finishWrite();
     static void makeDirectory(char* filename);
     static void closeFile();
@@ -200,6 +233,7 @@ class SDCard {
 
     #if HAS_SD_RESTART
       static void open_restart_file(const bool read);
+      static bool create_restart_file(const uint32_t size);
       static void delete_restart_file();
       static bool exist_restart_file();
     #endif
@@ -209,6 +243,11 @@ class SDCard {
       static void write_eeprom();
     #endif
 
+    #if ENABLED(AUTO_BED_LEVELING_UBL) && UBL_MESH_SD_SLOTS > 0
+      static bool write_mesh_file(const uint8_t index, const void * const data, const uint16_t size);
+      static bool read_mesh_file(const uint8_t index, void * const data, const uint16_t size);
+    #endif
+
     #if ENABLED(SDCARD_SORT_ALPHA)
       static void presort();
       static void getfilename_sorted(const uint16_t nr);
@@ -248,10 +287,22 @@ class SDCard {
     static inline void pauseSDPrint() { setPrinting(false); }
     static inline bool isFileOpen()   { return isDetected() && gcode_file.isOpen(); }
     static inline bool isPaused()     { return isFileOpen() && !isPrinting(); }
-    static inline void setIndex(uint32_t newpos) { sdpos = newpos; gcode_file.seekSet(sdpos); }
+    static inline void setIndex(uint32_t newpos) {
+      sdpos = newpos;
+      #if ENABLED(SD_CONTIGUOUS_READ)
+        read_pos = newpos;
+      #endif
+      gcode_file.seekSet(sdpos);
+    }
     static inline uint32_t getIndex() { return sdpos; }
     static inline bool eof() { return sdpos >= fileSize; }
-    static inline int16_t get() { sdpos = gcode_file.curPosition(); return (int16_t)gcode_file.read(); }
+    static inline int16_t get() {
+      #if ENABLED(SD_CONTIGUOUS_READ)
+        if (contiguous_block) return get_contiguous();
+      #endif
+      sdpos = gcode_file.curPosition();
+      return (int16_t)gcode_file.read();
+    }
     static inline uint8_t percentDone() { return (isFileOpen() && fileSize) ? sdpos / ((fileSize + 99) / 100) : 0; }
     static inline void getWorkDirName() { workDir.getName(fileName, LONG_FILENAME_LENGTH); }
     static inline size_t read(void* buf, uint16_t nbyte) { return gcode_file.isOpen() ? gcode_file.read(buf, nbyte) : -1; }
@@ -267,6 +318,16 @@ class SDCard {
   private: /** Private Function */
 
     static void lsDive(SdFile parent, PGM_P const match = NULL);
+
+    #if ENABLED(BINARY_FILE_UPLOAD) || ENABLED(SD_PREALLOCATE_WRITE)
+      static bool create_contiguous(char* filename, const uint32_t size);
+    #endif
+    static void close_write_file();
+
+    #if ENABLED(SD_CONTIGUOUS_READ)
+      static int16_t get_contiguous();
+      static bool read_blocks(const uint32_t block);
+    #endif
     static void parsejson(SdFile &parser_file);
     static bool findGeneratedBy(char* buf, char* genBy);
     static bool findFirstLayerHeight(char* buf, float &firstlayerHeight);
@@ -274,8 +335,30 @@ class SDCard {
     static bool findFilamentNeed(char* buf, float &filament);
     static bool findTotalHeight(char* buf, float &objectHeight);
 
+    #if ENABLED(SD_JOB_META_CACHE)
+      static bool job_meta_key(job_meta_t &meta);
+      static bool load_job_meta();
+      static void save_job_meta();
+    #endif
+
+    #if ENABLED(ADAPTIVE_MESH_LEVELING)
+      static void parse_print_area(SdFile &parser_file);
+      static bool findHeaderValue(char* buf, PGM_P key, float &value);
+    #endif
+
     #if ENABLED(SDCARD_SORT_ALPHA)
       static void flush_presort();
+      #if ENABLED(SDSORT_USES_RAM)
+        static bool sort_add_name();
+        #if ENABLED(SDSORT_DYNAMIC_RAM)
+          static void free_sort_names();
+        #endif
+        FORCE_INLINE static char* sort_name(const uint16_t i) { return &sort_pool[sort_offset[i]]; }
+      #endif
+    #endif
+
+    #if ENABLED(SD_DIR_INDEX)
+      static inline void flush_dir_index() { dir_index_files = SD_DIR_INDEX_UNKNOWN; dir_index_pages = 0; }
     #endif
 
     #if ENABLED(ADVANCED_SD_COMMAND)
@@ -0,0 +1,194 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * sdupload.cpp - Binary file upload to SD card
+ */
+
+#include "../../MK4duo.h"
+
+#if ENABLED(BINARY_FILE_UPLOAD)
+
+SDUpload sdupload;
+
+// Time without bytes before the chunk is requested again
+constexpr millis_s sd_upload_timeout = 1000;
+// Requests without an answer before the upload is aborted
+constexpr uint8_t  sd_upload_retries = 5;
+
+/** Private Parameters */
+uint8_t   SDUpload::header[4],
+          SDUpload::buffer[SD_UPLOAD_CHUNK_SIZE + 2];
+
+int8_t    SDUpload::port = -1;
+
+uint8_t   SDUpload::seq     = 0,
+          SDUpload::retries = 0;
+
+uint16_t  SDUpload::index   = 0,
+          SDUpload::length  = 0;
+
+uint32_t  SDUpload::file_size = 0,
+          SDUpload::written   = 0;
+
+millis_s  SDUpload::last_byte_ms = 0;
+
+/** Public Function */
+void SDUpload::start(char * const filename, const uint32_t size, const int8_t serial_port) {
+
+  if (serial_port < 0) {
+    SERIAL_LM(ER, "Binary upload needs a serial port");
+    return;
+  }
+
+  if (!card.startContiguousWrite(filename, size)) return;
+
+  seq           = 0;
+  retries       = 0;
+  index         = 0;
+  file_size     = size;
+  written       = 0;
+  last_byte_ms  = millis();
+  port          = serial_port;
+
+}
+
+void SDUpload::receive() {
+
+  int c;
+
+  while ((c = Com::serialRead(port)) >= 0) {
+
+    last_byte_ms = millis();
+    retries = 0;
+
+    if (index < 4) {
+      if (index == 0 && c != 0xB5) continue;  // Wait for the start of a chunk
+      header[index++] = c;
+      if (index == 4) {
+        length = header[2] | (header[3] << 8);
+        if (length > SD_UPLOAD_CHUNK_SIZE) {
+          index = 0;
+          reply(PSTR("rs B"), seq);
+        }
+      }
+    }
+    else {
+      buffer[index++ - 4] = c;
+      if (index == length + 6) {
+        index = 0;
+        process_chunk();
+        if (!isActive()) return;
+      }
+    }
+
+  }
+
+  // Bytes lost, ask the chunk again. A host that stays silent
+  // is given up on and serial goes back to the line reader.
+  if (expired(&last_byte_ms, sd_upload_timeout)) {
+    index = 0;
+    if (++retries > sd_upload_retries)
+      stop(PSTR("Binary upload timeout"));
+    else
+      reply(PSTR("rs B"), seq);
+  }
+
+}
+
+/** Private Function */
+void SDUpload::process_chunk() {
+
+  const uint8_t s = header[1];
+
+  uint16_t crc = 0;
+  crc16(&crc, buffer, length);
+  if (crc != (buffer[length] | (buffer[length + 1] << 8))) {
+    reply(PSTR("rs B"), seq);
+    return;
+  }
+
+  // The ok for the last chunk was lost, it is already written
+  if (written && s == uint8_t(seq - 1)) {
+    reply(PSTR("ok B"), s);
+    return;
+  }
+
+  if (s != seq) {
+    reply(PSTR("rs B"), seq);
+    return;
+  }
+
+  if (length == 0) {
+    reply(PSTR("ok B"), s);
+    stop(written == file_size ? nullptr : PSTR("Binary upload incomplete"));
+    return;
+  }
+
+  // Keep every write on whole blocks of the preallocated file
+  const uint32_t left = file_size - written;
+  if (length != (left < SD_UPLOAD_CHUNK_SIZE ? left : SD_UPLOAD_CHUNK_SIZE)) {
+    stop(PSTR("Binary upload wrong chunk size"));
+    return;
+  }
+
+  #if ENABLED(SD_IO_WORKER)
+    const bool failed = !sdworker.write(buffer, length);
+  #else
+    const bool failed = card.write(buffer, length) != length;
+  #endif
+  if (failed) {
+    stop(PSTR(MSG_SD_ERR_WRITE_TO_FILE));
+    return;
+  }
+
+  written += length;
+  reply(PSTR("ok B"), seq++);
+
+}
+
+void SDUpload::reply(PGM_P const msg, const uint8_t s) {
+  SERIAL_PORT(port);
+  SERIAL_STR(msg);
+  SERIAL_VAL(int(s));
+  SERIAL_EOL();
+  SERIAL_PORT(-1);
+}
+
+void SDUpload::stop(PGM_P error) {
+  #if ENABLED(SD_IO_WORKER)
+    if (!sdworker.flush() && !error) error = PSTR(MSG_SD_ERR_WRITE_TO_FILE);
+  #endif
+  card.closeFile();
+  SERIAL_PORT(port);
+  if (error) {
+    SERIAL_STR(ER);
+    SERIAL_STR(error);
+    SERIAL_EOL();
+  }
+  else
+    SERIAL_EM(MSG_SD_FILE_SAVED);
+  SERIAL_PORT(-1);
+  port = -1;
+}
+
+#endif // ENABLED(BINARY_FILE_UPLOAD)
@@ -0,0 +1,88 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * sdupload.h - Binary file upload to SD card
+ *
+ * Started with "M28 B<bytes> <filename>". The file is created preallocated
+ * and the host then sends chunks, each one:
+ *
+ *   0xB5, seq, length (2 bytes LE), data (length bytes), CRC16 of data (2 bytes LE)
+ *
+ * Every chunk except the last has SD_UPLOAD_CHUNK_SIZE bytes, so all writes
+ * cover whole card blocks. A chunk with length 0 ends the upload.
+ * The firmware answers "ok B<seq>" for a written chunk and "rs B<seq>"
+ * to request the chunk with sequence seq again. After a few requests
+ * without any byte from the host the upload is aborted.
+ */
+
+#if ENABLED(BINARY_FILE_UPLOAD)
+
+#define SD_UPLOAD_CHUNK_SIZE  512
+
+class SDUpload {
+
+  public: /** Constructor */
+
+    SDUpload() {}
+
+  private: /** Private Parameters */
+
+    static uint8_t  header[4],
+                    buffer[SD_UPLOAD_CHUNK_SIZE + 2];
+
+    static int8_t   port;
+
+    static uint8_t  seq,
+                    retries;
+
+    static uint16_t index,
+                    length;
+
+    static uint32_t file_size,
+                    written;
+
+    static millis_s last_byte_ms;
+
+  public: /** Public Function */
+
+    static void start(char * const filename, const uint32_t size, const int8_t serial_port);
+
+    /**
+     * Called in place of the line reader while an upload is active
+     */
+    static void receive();
+
+    FORCE_INLINE static bool isActive() { return port >= 0; }
+
+  private: /** Private Function */
+
+    static void process_chunk();
+    static void reply(PGM_P const msg, const uint8_t s);
+    static void stop(PGM_P error);
+
+};
+
+extern SDUpload sdupload;
+
+#endif // ENABLED(BINARY_FILE_UPLOAD)
@@ -0,0 +1,91 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * sdworker.cpp - Queued writes to SD card
+ */
+
+#include "../../MK4duo.h"
+
+#if ENABLED(SD_IO_WORKER)
+
+SDWorker sdworker;
+
+/** Private Parameters */
+uint8_t   SDWorker::buffer[SD_IO_WORKER_BUFFER];
+
+uint16_t  SDWorker::head  = 0,
+          SDWorker::count = 0;
+
+bool      SDWorker::error = false;
+
+/** Public Function */
+bool SDWorker::write(const void * const buf, uint16_t nbyte) {
+
+  const uint8_t *src = (const uint8_t*)buf;
+
+  while (nbyte && !error) {
+    if (count == SD_IO_WORKER_BUFFER && !write_block()) break;
+    uint16_t tail = head + count;
+    if (tail >= SD_IO_WORKER_BUFFER) tail -= SD_IO_WORKER_BUFFER;
+    const uint16_t n = MIN(nbyte, uint16_t(SD_IO_WORKER_BUFFER - count), uint16_t(SD_IO_WORKER_BUFFER - tail));
+    memcpy(&buffer[tail], src, n);
+    count += n;
+    src   += n;
+    nbyte -= n;
+  }
+
+  return !error;
+}
+
+void SDWorker::spin() {
+  // Partial blocks wait for more data or for the flush
+  if (count >= 512) (void)write_block();
+}
+
+bool SDWorker::flush() {
+  while (count && write_block()) { /* nada */ }
+  const bool ok = !error;
+  error = false;
+  return ok;
+}
+
+/** Private Function */
+bool SDWorker::write_block() {
+
+  const uint16_t n = MIN(count, uint16_t(512), uint16_t(SD_IO_WORKER_BUFFER - head));
+
+  if (card.write(&buffer[head], n) != n) {
+    SERIAL_LM(ER, MSG_SD_ERR_WRITE_TO_FILE);
+    error = true;
+    head = count = 0;
+    return false;
+  }
+
+  count -= n;
+  head = count ? head + n : 0;  // Restart aligned when empty
+  if (head == SD_IO_WORKER_BUFFER) head = 0;
+
+  return true;
+}
+
+#endif // ENABLED(SD_IO_WORKER)
@@ -0,0 +1,79 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2019 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * sdworker.h - Queued writes to SD card
+ *
+ * The data written to the file open for writing (M28 and the binary upload)
+ * is queued in a RAM buffer. The idle loop writes it to the card one block
+ * for each call, so command processing doesn't wait for the card.
+ * The rest is written when the file is closed.
+ */
+
+#if ENABLED(SD_IO_WORKER)
+
+class SDWorker {
+
+  public: /** Constructor */
+
+    SDWorker() {}
+
+  private: /** Private Parameters */
+
+    static uint8_t  buffer[SD_IO_WORKER_BUFFER];
+
+    static uint16_t head,   // Next byte to write to the card
+                    count;  // Bytes queued
+
+    static bool     error;
+
+  public: /** Public Function */
+
+    /**
+     * Queue the data, writing a block first if the buffer is full.
+     * Return 'false' if a write has failed.
+     */
+    static bool write(const void * const buf, uint16_t nbyte);
+
+    /**
+     * Called from idle, write a full block
+     */
+    static void spin();
+
+    /**
+     * Write all the data queued.
+     * Return 'false' if a write has failed.
+     */
+    static bool flush();
+
+    FORCE_INLINE static bool isEmpty() { return count == 0; }
+
+  private: /** Private Function */
+
+    static bool write_block();
+
+};
+
+extern SDWorker sdworker;
+
+#endif // ENABLED(SD_IO_WORKER)